@@ -0,0 +1,70 @@
+#include "Arduino.h"
+#include "WiFi.h"
+#include "SPI.h"
+
+#include <chrono>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                         HOST-SHIM: LAUFZEIT-IMPLEMENTIERUNG
+// ═══════════════════════════════════════════════════════════════════════════════
+
+HostSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+SPIClass SPI;
+
+static unsigned long hostMillis = 0;
+static int hostHour = 12, hostMinute = 0, hostSecond = 0;
+
+unsigned long millis() { return hostMillis; }
+// micros() misst echte Host-CPU-Zeit (nur für Profiling, nie für Bildinhalte)
+unsigned long micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now() - start).count();
+}
+void hostSetMillis(unsigned long ms) { hostMillis = ms; }
+void hostAdvanceMillis(unsigned long ms) { hostMillis += ms; }
+void delay(unsigned long ms) { hostMillis += ms; }
+void delayMicroseconds(unsigned int) {}
+
+static int hostPinLevels[64];   // LOW
+
+void digitalWrite(int pin, int level) {
+  if (pin >= 0 && pin < 64) hostPinLevels[pin] = level;
+}
+int hostPinLevel(int pin) { return (pin >= 0 && pin < 64) ? hostPinLevels[pin] : HIGH; }
+
+bool getLocalTime(struct tm* info, uint32_t) {
+  memset(info, 0, sizeof(*info));
+  info->tm_year = 125;
+  info->tm_mon = 0;
+  info->tm_mday = 15;
+  info->tm_hour = hostHour;
+  info->tm_min = hostMinute;
+  info->tm_sec = hostSecond;
+  return true;
+}
+
+void hostSetLocalTime(int hour, int minute, int second) {
+  hostHour = hour;
+  hostMinute = minute;
+  hostSecond = second;
+}
+
+long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+long random(long howsmall, long howbig) { return howbig > howsmall ? howsmall + rand() % (howbig - howsmall) : howsmall; }
+
+void HostSerial::print(const char* s) { if (!quiet_) fputs(s, stdout); }
+void HostSerial::print(int v) { if (!quiet_) printf("%d", v); }
+void HostSerial::println(const char* s) { if (!quiet_) { fputs(s, stdout); fputc('\n', stdout); } }
+void HostSerial::println(int v) { if (!quiet_) printf("%d\n", v); }
+
+int HostSerial::printf(const char* fmt, ...) {
+  if (quiet_) return 0;
+  va_list args;
+  va_start(args, fmt);
+  int n = vprintf(fmt, args);
+  va_end(args);
+  return n;
+}
@@ -0,0 +1,194 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                    HOST-SHIM: MINIMALE ARDUINO-UMGEBUNG (NATIVE BUILD)
+// ═══════════════════════════════════════════════════════════════════════════════
+// Stellt nur die Teile der Arduino/ESP32-API bereit, die von den Render-Modulen
+// benötigt werden. Zeit läuft über eine steuerbare virtuelle Uhr (hostSetMillis),
+// damit Screenshots reproduzierbar sind.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdarg>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+using std::abs;
+using std::isnan;
+using std::isinf;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+typedef uint8_t byte;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Virtuelle Uhr (micros() dagegen ist die echte Host-Zeit für Messungen)
+unsigned long millis();
+unsigned long micros();
+void hostSetMillis(unsigned long ms);
+void hostAdvanceMillis(unsigned long ms);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+inline void yield() {}
+
+// Lokale Zeit (über hostSetLocalTime steuerbar)
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void hostSetLocalTime(int hour, int minute, int second);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+inline void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+// ───────────────────────────────────────────────────────────────────────────────
+// String (Teilmenge)
+// ───────────────────────────────────────────────────────────────────────────────
+class String {
+public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(float v, unsigned int decimals = 2) { format(v, decimals); }
+  String(double v, unsigned int decimals = 2) { format(v, decimals); }
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.length(); }
+  char charAt(unsigned int i) const { return i < s_.length() ? s_[i] : 0; }
+  String substring(unsigned int from) const { return from < s_.length() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from >= s_.length() || to <= from) return String();
+    return String(s_.substr(from, to - from));
+  }
+  int indexOf(const char* needle) const {
+    size_t pos = s_.find(needle);
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  long toInt() const { return atol(s_.c_str()); }
+
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.s_); }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+
+private:
+  void format(double v, unsigned int decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+  }
+  std::string s_;
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Serial (stdout, per HOST_QUIET_SERIAL stummschaltbar)
+// ───────────────────────────────────────────────────────────────────────────────
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  void print(const char* s);
+  void print(const String& s) { print(s.c_str()); }
+  void print(int v);
+  void println(const char* s = "");
+  void println(const String& s) { println(s.c_str()); }
+  void println(int v);
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  void setQuiet(bool quiet) { quiet_ = quiet; }
+
+private:
+  bool quiet_ = true;
+};
+
+extern HostSerial Serial;
+
+// ───────────────────────────────────────────────────────────────────────────────
+// ESP-Systemfunktionen (Heap-Werte sind Fixwerte)
+// ───────────────────────────────────────────────────────────────────────────────
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 180000; }
+  uint32_t getMaxAllocHeap() { return 110000; }
+  uint32_t getPsramSize() { return 0; }
+  uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+  uint64_t getEfuseMac() { return 0x1234ABCDull; }
+  void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+// GPIO/ADC sind auf dem Host wirkungslos; Ausgänge merken sich ihren Pegel
+// (CS-Pins mehrerer Panels, siehe TFT_eSPI::hostAttachPanel)
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define LOW 0x0
+#define HIGH 0x1
+inline void pinMode(int, int) {}
+void digitalWrite(int pin, int level);
+int hostPinLevel(int pin);
+inline int digitalRead(int) { return LOW; }
+inline int analogRead(int) { return 0; }
+#define ADC_11db 3
+inline void analogSetAttenuation(int) {}
+inline double ledcSetup(uint8_t, double frequency, uint8_t) { return frequency; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+
+// ───────────────────────────────────────────────────────────────────────────────
+// FreeRTOS (Teilmenge). Auf dem Host gibt es keine Tasks: xTaskCreatePinnedToCore
+// schlägt fehl, der Code zeichnet dann wie ohne Render-Task synchron.
+// ───────────────────────────────────────────────────────────────────────────────
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*,
+                                          UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  if (handle) *handle = nullptr;
+  return pdFAIL;
+}
+inline void vTaskDelay(TickType_t) {}
+inline BaseType_t xPortGetCoreID() { return 1; }
+inline QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t) { return nullptr; }
+inline BaseType_t xQueueSend(QueueHandle_t, const void*, TickType_t) { return pdFALSE; }
+inline BaseType_t xQueueReceive(QueueHandle_t, void*, TickType_t) { return pdFALSE; }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return nullptr; }
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t) { return pdTRUE; }
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return nullptr; }
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t*) {}
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+#define portYIELD_FROM_ISR()
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,19 @@
+#ifndef HOST_ARDUINOOTA_H
+#define HOST_ARDUINOOTA_H
+
+// Host-Shim: nur die Typen, die in ota.h deklariert werden.
+
+#include "Arduino.h"
+
+typedef enum {
+  OTA_AUTH_ERROR,
+  OTA_BEGIN_ERROR,
+  OTA_CONNECT_ERROR,
+  OTA_RECEIVE_ERROR,
+  OTA_END_ERROR
+} ota_error_t;
+
+#define U_FLASH 0
+#define U_SPIFFS 100
+
+#endif // HOST_ARDUINOOTA_H
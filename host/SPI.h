@@ -0,0 +1,18 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+class SPIClass {
+public:
+  explicit SPIClass(uint8_t = 0) {}
+  void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void end() {}
+};
+
+#define VSPI 3
+#define HSPI 2
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
@@ -0,0 +1,577 @@
+#include "TFT_eSPI.h"
+#include "glcdfont.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              HILFSFUNKTIONEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static inline uint16_t swap16(uint16_t v) { return (uint16_t)((v >> 8) | (v << 8)); }
+
+// UTF-8 dekodieren (wie TFT_eSPI::decodeUTF8 für 2- und 3-Byte-Sequenzen)
+static uint16_t decodeUTF8Sequence(const uint8_t* buf, uint16_t* index, uint16_t remaining) {
+  uint16_t c = buf[(*index)++];
+  if ((c & 0x80) == 0x00) return c;
+  if (((c & 0xE0) == 0xC0) && (remaining > 1)) {
+    return ((c & 0x1F) << 6) | (buf[(*index)++] & 0x3F);
+  }
+  if (((c & 0xF0) == 0xE0) && (remaining > 2)) {
+    c = ((c & 0x0F) << 12) | ((buf[(*index)++] & 0x3F) << 6);
+    return c | (buf[(*index)++] & 0x3F);
+  }
+  return c;
+}
+
+struct HostFontMetrics {
+  int16_t advance;   // Zellbreite
+  int16_t height;    // Zellhöhe
+  int16_t glyphW;    // skalierte Glyphenbreite
+  int16_t glyphH;    // skalierte Glyphenhöhe
+  int16_t offsetY;   // vertikaler Versatz in der Zelle
+};
+
+static HostFontMetrics metricsFor(uint8_t font) {
+  switch (font) {
+    case 2:  return {8, 16, 7, 16, 0};
+    case 4:  return {14, 26, 12, 24, 1};
+    default: return {6, 8, 5, 8, 0};
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              TFT_eSPI (PANEL)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+  : _init_width(w), _init_height(h), _width(w), _height(h) {
+  _vpW = _width;
+  _vpH = _height;
+  _xWidth = _width;
+  _yHeight = _height;
+}
+
+void TFT_eSPI::init(uint8_t) {
+  framebuffer.assign((size_t)_init_width * _init_height, TFT_BLACK);
+  panelBuffers.assign(panelPins.size(), framebuffer);
+  resetViewport();
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r % 4;
+  if (rotation & 1) {
+    _width = _init_height;
+    _height = _init_width;
+  } else {
+    _width = _init_width;
+    _height = _init_height;
+  }
+  resetViewport();
+}
+
+int16_t TFT_eSPI::width(void) { return _vpDatum ? _xWidth : _width; }
+int16_t TFT_eSPI::height(void) { return _vpDatum ? _yHeight : _height; }
+
+void TFT_eSPI::storePixel(int32_t x, int32_t y, uint16_t color) {
+  if (framebuffer.empty()) return;
+  size_t index = (size_t)y * _width + x;
+  if (panelBuffers.empty()) {
+    framebuffer[index] = color;
+  } else {
+    for (size_t panel = 0; panel < panelBuffers.size(); panel++) {
+      if (hostPinLevel(panelPins[panel]) == LOW) panelBuffers[panel][index] = color;
+    }
+  }
+  pixelsWritten++;
+}
+
+uint16_t TFT_eSPI::loadPixel(int32_t x, int32_t y) {
+  if (framebuffer.empty()) return 0;
+  size_t index = (size_t)y * _width + x;
+  for (size_t panel = 0; panel < panelBuffers.size(); panel++) {
+    if (hostPinLevel(panelPins[panel]) == LOW) return panelBuffers[panel][index];
+  }
+  return framebuffer[index];
+}
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Viewport
+// ───────────────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  int32_t fullW = _vpDatum ? _width : width();
+  int32_t fullH = _vpDatum ? _height : height();
+  resetViewport();
+  fullW = width();
+  fullH = height();
+
+  _xDatum = x;
+  _yDatum = y;
+  _xWidth = w;
+  _yHeight = h;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > fullW) w = fullW - x;
+  if ((y + h) > fullH) h = fullH - y;
+
+  if (w < 1 || h < 1) {
+    _xDatum = 0; _yDatum = 0; _xWidth = fullW; _yHeight = fullH;
+    _vpOoB = true;
+    return;
+  }
+
+  if (!vpDatum) {
+    _xDatum = 0; _yDatum = 0; _xWidth = fullW; _yHeight = fullH;
+  }
+  _vpDatum = vpDatum;
+
+  _vpX = x;
+  _vpY = y;
+  _vpW = x + w;
+  _vpH = y + h;
+}
+
+void TFT_eSPI::resetViewport(void) {
+  _vpDatum = false;
+  _vpOoB = false;
+  _xDatum = 0;
+  _yDatum = 0;
+  _vpX = 0;
+  _vpY = 0;
+  _vpW = width();
+  _vpH = height();
+  _xWidth = _vpW;
+  _yHeight = _vpH;
+}
+
+bool TFT_eSPI::checkViewport(int32_t x, int32_t y, int32_t w, int32_t h) {
+  if (_vpOoB) return false;
+  x += _xDatum;
+  y += _yDatum;
+  if (x >= _vpW || y >= _vpH) return false;
+  if (x + w <= _vpX || y + h <= _vpY) return false;
+  return true;
+}
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Primitive
+// ───────────────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  if (_vpOoB) return;
+  x += _xDatum;
+  y += _yDatum;
+  if (x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return;
+  storePixel(x, y, (uint16_t)color);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  if (_vpOoB) return 0;
+  x += _xDatum;
+  y += _yDatum;
+  if (x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return 0;
+  return loadPixel(x, y);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (_vpOoB) return;
+  x += _xDatum;
+  y += _yDatum;
+  if (x < _vpX) { w += x - _vpX; x = _vpX; }
+  if (y < _vpY) { h += y - _vpY; y = _vpY; }
+  if (x + w > _vpW) w = _vpW - x;
+  if (y + h > _vpH) h = _vpH - y;
+  if (w < 1 || h < 1) return;
+  for (int32_t yy = y; yy < y + h; yy++) {
+    for (int32_t xx = x; xx < x + w; xx++) {
+      storePixel(xx, yy, (uint16_t)color);
+    }
+  }
+}
+
+// Wie im Original ohne virtuellen Umweg über fillRect (Unterklassen zählen sonst doppelt)
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  TFT_eSPI::fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  TFT_eSPI::fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+  if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+
+  int32_t dx = x1 - x0, dy = abs(y1 - y0);
+  int32_t err = dx >> 1, ystep = (y0 < y1) ? 1 : -1;
+
+  for (; x0 <= x1; x0++) {
+    if (steep) drawPixel(y0, x0, color);
+    else drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++; ddF_x += 2; f += ddF_x;
+    if (cornername & 0x4) { drawPixel(x0 + x, y0 + y, color); drawPixel(x0 + y, y0 + x, color); }
+    if (cornername & 0x2) { drawPixel(x0 + x, y0 - y, color); drawPixel(x0 + y, y0 - x, color); }
+    if (cornername & 0x8) { drawPixel(x0 - y, y0 + x, color); drawPixel(x0 - x, y0 + y, color); }
+    if (cornername & 0x1) { drawPixel(x0 - y, y0 - x, color); drawPixel(x0 - x, y0 - y, color); }
+  }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++; ddF_x += 2; f += ddF_x;
+    if (x < (y + 1)) {
+      if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++; ddF_x += 2; f += ddF_x;
+    drawPixel(x0 + x, y0 + y, color); drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color); drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color); drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color); drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void TFT_eSPI::drawTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color) {
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x3, y3, color);
+  drawLine(x3, y3, x1, y1, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+  int32_t a, b, y, last;
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+  if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+  if (y0 == y2) {
+    a = b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+          dx12 = x2 - x1, dy12 = y2 - y1, sa = 0, sb = 0;
+
+  last = (y1 == y2) ? y1 : y1 - 1;
+
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+  int32_t byteWidth = (w + 7) / 8;
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      if (bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7))) {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+}
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Text
+// ───────────────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::setTextColor(uint16_t c) {
+  textcolor = textbgcolor = c;
+}
+
+void TFT_eSPI::setTextColor(uint16_t c, uint16_t b, bool) {
+  textcolor = c;
+  textbgcolor = b;
+}
+
+int16_t TFT_eSPI::glyphAdvance(uint16_t, uint8_t font) const {
+  return metricsFor(font).advance;
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+  HostFontMetrics m = metricsFor(font);
+
+  if (textbgcolor != textcolor) {
+    fillRect(x, y, m.advance, m.height, textbgcolor);
+  }
+
+  uint16_t c = (uniCode >= 0x20 && uniCode <= 0x7E) ? uniCode : '?';
+  const uint8_t* glyph = &glcdFont[(c - 0x20) * 5];
+
+  // Glyph zeilenweise abtasten und als waagrechte Läufe zeichnen
+  for (int16_t ty = 0; ty < m.glyphH; ty++) {
+    int16_t srcRow = ty * 8 / m.glyphH;
+    int16_t runStart = -1;
+    for (int16_t tx = 0; tx <= m.glyphW; tx++) {
+      bool on = false;
+      if (tx < m.glyphW) {
+        int16_t srcCol = tx * 5 / m.glyphW;
+        on = (glyph[srcCol] >> srcRow) & 0x01;
+      }
+      if (on && runStart < 0) {
+        runStart = tx;
+      } else if (!on && runStart >= 0) {
+        drawFastHLine(x + runStart, y + m.offsetY + ty, tx - runStart, textcolor);
+        runStart = -1;
+      }
+    }
+  }
+
+  return m.advance;
+}
+
+uint16_t TFT_eSPI::decodeUTF8(uint8_t* buf, uint16_t* index, uint16_t remaining) {
+  return decodeUTF8Sequence(buf, index, remaining);
+}
+
+int16_t TFT_eSPI::drawString(const char* string, int32_t x, int32_t y, uint8_t font) {
+  if (string == nullptr) return 0;
+  uint16_t len = (uint16_t)strlen(string);
+  uint16_t n = 0;
+  int32_t sumX = 0;
+  while (n < len) {
+    uint16_t uniCode = decodeUTF8Sequence((const uint8_t*)string, &n, len - n);
+    sumX += drawChar(uniCode, x + sumX, y, font);
+  }
+  return (int16_t)sumX;
+}
+
+int16_t TFT_eSPI::drawString(const String& string, int32_t x, int32_t y, uint8_t font) {
+  return drawString(string.c_str(), x, y, font);
+}
+
+int16_t TFT_eSPI::textWidth(const char* string, uint8_t font) {
+  if (string == nullptr) return 0;
+  uint16_t len = (uint16_t)strlen(string);
+  uint16_t n = 0;
+  int32_t width = 0;
+  while (n < len) {
+    uint16_t uniCode = decodeUTF8Sequence((const uint8_t*)string, &n, len - n);
+    width += glyphAdvance(uniCode, font);
+  }
+  return (int16_t)width;
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font) {
+  return metricsFor((uint8_t)font).height;
+}
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Bilddaten
+// ───────────────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  if (_vpOoB || data == nullptr) return;
+  int32_t x0 = x + _xDatum, y0 = y + _yDatum;
+  for (int32_t j = 0; j < h; j++) {
+    int32_t py = y0 + j;
+    if (py < _vpY || py >= _vpH) continue;
+    for (int32_t i = 0; i < w; i++) {
+      int32_t px = x0 + i;
+      if (px < _vpX || px >= _vpW) continue;
+      uint16_t v = data[j * w + i];
+      storePixel(px, py, _swapBytes ? v : swap16(v));
+    }
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  pushImage(x, y, w, h, (const uint16_t*)data);
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t*) {
+  pushImage(x, y, w, h, (const uint16_t*)data);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              TFT_eSprite
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), _tft(tft) {}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t) {
+  if (_created) return buffer.data();
+  if (w < 1 || h < 1) return nullptr;
+
+  _dwidth = _width = w;
+  _dheight = _height = h;
+  _bitwidth = (w + 7) & ~7;
+
+  size_t bytes = 0;
+  if (_bpp == 16) bytes = (size_t)w * h * 2;
+  else if (_bpp == 8) bytes = (size_t)w * h;
+  else bytes = (size_t)_bitwidth * h / 8;
+
+  buffer.assign(bytes, 0);
+  _created = true;
+  resetViewport();
+  return buffer.data();
+}
+
+void TFT_eSprite::deleteSprite(void) {
+  buffer.clear();
+  buffer.shrink_to_fit();
+  _created = false;
+}
+
+void* TFT_eSprite::setColorDepth(int8_t b) {
+  int16_t w = _dwidth, h = _dheight;
+  bool wasCreated = _created;
+  if (wasCreated) deleteSprite();
+  _bpp = (b >= 16) ? 16 : (b >= 8 ? 8 : 1);
+  if (wasCreated) return createSprite(w, h);
+  return nullptr;
+}
+
+void TFT_eSprite::storePixel(int32_t x, int32_t y, uint16_t color) {
+  if (!_created) return;
+  if (_bpp == 16) {
+    uint16_t* img = (uint16_t*)buffer.data();
+    img[(size_t)y * _dwidth + x] = swap16(color);
+  } else if (_bpp == 8) {
+    buffer[(size_t)y * _dwidth + x] = (uint8_t)(((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3));
+  } else {
+    size_t index = ((size_t)y * _bitwidth + x) >> 3;
+    if (color) buffer[index] |= (0x80 >> (x & 7));
+    else buffer[index] &= ~(0x80 >> (x & 7));
+  }
+}
+
+uint16_t TFT_eSprite::loadPixel(int32_t x, int32_t y) {
+  if (!_created) return 0;
+  if (_bpp == 16) {
+    const uint16_t* img = (const uint16_t*)buffer.data();
+    return swap16(img[(size_t)y * _dwidth + x]);
+  } else if (_bpp == 8) {
+    uint8_t c = buffer[(size_t)y * _dwidth + x];
+    uint16_t r = ((c >> 5) & 0x07) * 31 / 7;
+    uint16_t g = ((c >> 2) & 0x07) * 63 / 7;
+    uint16_t b = (c & 0x03) * 31 / 3;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+  }
+  size_t index = ((size_t)y * _bitwidth + x) >> 3;
+  return (buffer[index] & (0x80 >> (x & 7))) ? _bitmap_fg : _bitmap_bg;
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+  return TFT_eSPI::readPixel(x, y);
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+  if (!_created) return;
+  fillRect(0 - _xDatum, 0 - _yDatum, _dwidth, _dheight, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (!_created || _tft == nullptr) return;
+  if (_bpp == 16) {
+    bool oldSwapBytes = _tft->getSwapBytes();
+    _tft->setSwapBytes(false);
+    _tft->pushImage(x, y, _dwidth, _dheight, (const uint16_t*)buffer.data());
+    _tft->setSwapBytes(oldSwapBytes);
+    return;
+  }
+
+  std::vector<uint16_t> line((size_t)_dwidth * _dheight);
+  for (int32_t j = 0; j < _dheight; j++) {
+    for (int32_t i = 0; i < _dwidth; i++) {
+      line[(size_t)j * _dwidth + i] = loadPixel(i, j);
+    }
+  }
+  bool oldSwapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(true);
+  _tft->pushImage(x, y, _dwidth, _dheight, line.data());
+  _tft->setSwapBytes(oldSwapBytes);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  if (!_created || _tft == nullptr) return;
+  for (int32_t j = 0; j < _dheight; j++) {
+    for (int32_t i = 0; i < _dwidth; i++) {
+      uint16_t c = loadPixel(i, j);
+      if (c != transparent) _tft->drawPixel(x + i, y + j, c);
+    }
+  }
+}
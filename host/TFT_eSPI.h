@@ -0,0 +1,205 @@
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                HOST-SHIM: TFT_eSPI-KOMPATIBLER SOFTWARE-RASTERIZER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Bildet die von src/display.cpp genutzte Teilmenge der TFT_eSPI-API nach und
+// rastert in einen RGB565-Framebuffer im RAM. Semantik wie im Original:
+//   - Viewports (setViewport/resetViewport) mit Datum-Verschiebung und Clipping
+//   - drawPixel/drawLine/drawFastHLine/drawFastVLine/fillRect/drawChar sind
+//     virtual, damit Sprites und Recorder die Zeichenbefehle abfangen können
+//   - 16-Bit-Sprites speichern Farben byte-getauscht (Display-Reihenfolge),
+//     pushImage() tauscht nur bei setSwapBytes(true)
+// Schriften: Font 1 ist der klassische 5x7-GLCD-Font. Font 2 und 4 werden aus
+// denselben Glyphen skaliert (Zellhöhe 16 bzw. 26 px wie im Original), die
+// Zeichenbreiten sind daher nur angenähert.
+
+#include "Arduino.h"
+#include <vector>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+
+// Standardfarben (RGB565) wie in TFT_eSPI.h
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_TRANSPARENT 0x0120
+
+// Attribute für setAttribute()
+#define CP437_SWITCH 1
+#define UTF8_SWITCH  2
+#define PSRAM_ENABLE 3
+
+// Text-Datum (nur TL_DATUM wird vom Projekt genutzt)
+#define TL_DATUM 0
+
+class TFT_eSPI {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI() {}
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation; }
+  void invertDisplay(bool) {}
+  void setAttribute(uint8_t id = 0, uint8_t a = 0) { (void)id; (void)a; }
+
+  // Primitive (virtual wie im Original)
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color);
+  virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font);
+  virtual int16_t width(void);
+  virtual int16_t height(void);
+  virtual uint16_t readPixel(int32_t x, int32_t y);
+
+  // Zusammengesetzte Formen
+  void fillScreen(uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void drawTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color);
+  void fillTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t fgcolor);
+
+  // Text
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+  void setTextDatum(uint8_t datum) { textdatum = datum; }
+  void setTextFont(uint8_t font) { textfont = font; }
+  int16_t drawString(const char* string, int32_t x, int32_t y, uint8_t font);
+  int16_t drawString(const String& string, int32_t x, int32_t y, uint8_t font);
+  int16_t drawString(const char* string, int32_t x, int32_t y) { return drawString(string, x, y, textfont); }
+  int16_t textWidth(const char* string, uint8_t font);
+  int16_t textWidth(const String& string, uint8_t font) { return textWidth(string.c_str(), font); }
+  int16_t fontHeight(int16_t font);
+  uint16_t decodeUTF8(uint8_t* buf, uint16_t* index, uint16_t remaining);
+
+  // Viewport
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport(void);
+  bool checkViewport(int32_t x, int32_t y, int32_t w, int32_t h);
+  int32_t getViewportX(void) const { return _xDatum; }
+  int32_t getViewportY(void) const { return _yDatum; }
+  int32_t getViewportWidth(void) const { return _xWidth; }
+  int32_t getViewportHeight(void) const { return _yHeight; }
+
+  // Bilddaten und SPI
+  void startWrite(void) { inTransaction++; }
+  void endWrite(void) { if (inTransaction > 0) inTransaction--; }
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes(void) const { return _swapBytes; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+  // DMA (auf dem Host synchron)
+  bool initDMA(bool ctrl_cs = false) { (void)ctrl_cs; dmaEnabled = true; return true; }
+  void deInitDMA(void) { dmaEnabled = false; }
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+  bool dmaBusy(void) { return false; }
+  void dmaWait(void) {}
+
+  // Touch (XPT2046 über TFT_eSPI) - auf dem Host nie berührt
+  uint8_t getTouch(uint16_t* x, uint16_t* y, uint16_t threshold = 600) { (void)x; (void)y; (void)threshold; return 0; }
+
+  // ── Nur Host: Zugriff auf Framebuffer und Zähler ──
+  const std::vector<uint16_t>& hostFramebuffer() const { return panelBuffers.empty() ? framebuffer : panelBuffers[0]; }
+  // Mehrere Panels an einem Bus (vor init): je CS-Pin ein Framebuffer,
+  // Schreibzugriffe gehen an alle Panels, deren CS-Pin LOW ist
+  void hostAttachPanel(int csPin) { panelPins.push_back(csPin); }
+  const std::vector<uint16_t>& hostFramebuffer(int panel) const { return panelBuffers[panel]; }
+  unsigned long hostPixelsWritten() const { return pixelsWritten; }
+  void hostResetCounters() { pixelsWritten = 0; }
+
+protected:
+  // Schreibt einen bereits geclippten Pixel in den Zielspeicher
+  virtual void storePixel(int32_t x, int32_t y, uint16_t color);
+  virtual uint16_t loadPixel(int32_t x, int32_t y);
+
+  void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint32_t color);
+  void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+  int16_t glyphAdvance(uint16_t c, uint8_t font) const;
+
+  int32_t _init_width, _init_height;
+  int32_t _width, _height;
+  uint8_t rotation = 0;
+
+  // Viewport-Zustand (Namen wie im Original)
+  int32_t _vpX = 0, _vpY = 0, _vpW = 0, _vpH = 0;
+  int32_t _xDatum = 0, _yDatum = 0, _xWidth = 0, _yHeight = 0;
+  bool _vpDatum = false, _vpOoB = false;
+
+  uint32_t textcolor = TFT_WHITE, textbgcolor = TFT_WHITE;
+  uint8_t textfont = 1, textdatum = TL_DATUM;
+  bool _swapBytes = false;
+  bool dmaEnabled = false;
+  int inTransaction = 0;
+
+  std::vector<uint16_t> framebuffer;
+  std::vector<int> panelPins;
+  std::vector<std::vector<uint16_t>> panelBuffers;
+  unsigned long pixelsWritten = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite() override { deleteSprite(); }
+
+  void* createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+  void deleteSprite(void);
+  bool created(void) const { return _created; }
+  void* setColorDepth(int8_t b);
+  int8_t getColorDepth(void) const { return _bpp; }
+  void setBitmapColor(uint16_t fg, uint16_t bg) { _bitmap_fg = fg; _bitmap_bg = bg; }
+  void* getPointer(void) { return _created ? (void*)buffer.data() : nullptr; }
+
+  void fillSprite(uint32_t color);
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+
+  int16_t width(void) override { return _dwidth; }
+  int16_t height(void) override { return _dheight; }
+  uint16_t readPixel(int32_t x, int32_t y) override;
+
+protected:
+  void storePixel(int32_t x, int32_t y, uint16_t color) override;
+  uint16_t loadPixel(int32_t x, int32_t y) override;
+
+private:
+  TFT_eSPI* _tft;
+  bool _created = false;
+  int8_t _bpp = 16;
+  int32_t _dwidth = 0, _dheight = 0, _bitwidth = 0;
+  uint16_t _bitmap_fg = TFT_WHITE, _bitmap_bg = TFT_BLACK;
+  std::vector<uint8_t> buffer;
+};
+
+#endif // HOST_TFT_ESPI_H
@@ -0,0 +1,30 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// Host-Shim: WiFi ist im Native-Build immer "verbunden" mit festen Werten.
+
+#include "Arduino.h"
+
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+class IPAddress {
+public:
+  String toString() const { return String("192.168.1.50"); }
+};
+
+class WiFiClass {
+public:
+  int status() { return WL_CONNECTED; }
+  bool isConnected() { return true; }
+  int RSSI() { return -58; }
+  IPAddress localIP() { return IPAddress(); }
+  String SSID() { return String("HostNet"); }
+  String macAddress() { return String("00:00:00:00:00:00"); }
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient {};
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,25 @@
+#ifndef HOST_XPT2046_TOUCHSCREEN_H
+#define HOST_XPT2046_TOUCHSCREEN_H
+
+// Host-Shim: resistiver Touch ohne Hardware.
+
+#include "Arduino.h"
+#include "SPI.h"
+
+class TS_Point {
+public:
+  TS_Point() : x(0), y(0), z(0) {}
+  int16_t x, y, z;
+};
+
+class XPT2046_Touchscreen {
+public:
+  XPT2046_Touchscreen(uint8_t, uint8_t = 255) {}
+  bool begin() { return true; }
+  bool begin(SPIClass&) { return true; }
+  bool touched() { return false; }
+  TS_Point getPoint() { return TS_Point(); }
+  void setRotation(uint8_t) {}
+};
+
+#endif // HOST_XPT2046_TOUCHSCREEN_H
@@ -0,0 +1,21 @@
+#ifndef HOST_BB_CAPTOUCH_H
+#define HOST_BB_CAPTOUCH_H
+
+// Host-Shim: Touch-Controller ohne Hardware (meldet nie eine Berührung).
+
+#include "Arduino.h"
+
+typedef struct {
+  int count;
+  uint16_t x[5], y[5];
+  uint8_t pressure[5], area[5];
+} TOUCHINFO;
+
+class BBCapTouch {
+public:
+  int init(int, int, int, int, uint32_t = 400000) { return 0; }
+  int getSamples(TOUCHINFO* ti) { ti->count = 0; return 0; }
+  int sensorType() { return 0; }
+};
+
+#endif // HOST_BB_CAPTOUCH_H
@@ -0,0 +1,610 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "config.h"
+#include "display.h"
+#include "sensors.h"
+#include "ota.h"
+#include "touch.h"
+#include "image_writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                  HOST-RENDERER: ALLE SCREENS ALS PPM/PNG AUSGEBEN
+// ═══════════════════════════════════════════════════════════════════════════════
+// Aufruf: pio run -e native && .pio/build/native/program [ausgabeverzeichnis]
+// Rendert jeden DisplayMode mit festen Demo-Daten und schreibt <screen>.ppm
+// und <screen>.png. Pro Screen werden Renderzeit (Host-CPU), geschriebene
+// Pixel und ein Framebuffer-Hash ausgegeben - gleicher Hash = gleiches Bild.
+//
+// Benchmark: program --bench <manifest> [--update] [--no-timing]
+//                    [--reference <verzeichnis>] [ausgabeverzeichnis]
+// Rendert jeden Screen unter mehreren Sensor-Zuständen und vergleicht Hash,
+// Pixel, SPI-Bytes und Renderzeit mit dem Manifest (host/golden/bench.txt).
+// Gemessen wird nur updateDisplay(), nicht das Löschen durch den Harness.
+// Zeiten gelten relativ zu einer Kalibrierung im selben Prozess.
+// Exit-Code 1 bei geändertem Bild oder teurerem Zeichnen; abweichende Bilder
+// landen als PNG im Ausgabeverzeichnis. --update schreibt das Manifest neu,
+// mit --reference zusätzlich jedes Bild als PPM in das Verzeichnis; ohne
+// --update liest --reference bei geändertem Bild das alte und schreibt es
+// samt Differenzbild daneben.
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              GLOBALE OBJEKTE (wie main.cpp)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+ProfiledTFT tft;
+
+SensorData sensors[System::SENSOR_COUNT];
+SystemStatus systemStatus;
+AntiBurninManager antiBurnin;
+RenderManager renderManager;
+
+float stockReference = 0.0f;
+float stockPreviousClose = 0.0f;
+
+float pvPower = 0.0f;
+float gridPower = 0.0f;
+float loadPower = 0.0f;
+float storagePower = 0.0f;
+float wallboxPower = 0.0f;
+
+bool isGridFeedIn = false;
+bool isStorageCharging = false;
+
+unsigned long systemStartTime = 0;
+
+DisplayMode currentMode = HOME_SCREEN;
+unsigned long lastViewChangeTime = 0;
+
+DayAheadPriceData dayAheadPrices;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              STUBS FÜR HARDWARE-MODULE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TouchManager touchManager;
+TouchManager::TouchManager() : isInitialized(false), xptTouch(TouchConfig::XPT_CS_PIN),
+                               activeController(TOUCH_CST820_I2C), calibrationMode(false),
+                               hasCalibration(false), currentCalPoint(0), calibrationActive(false) {}
+void TouchManager::updateSensorTouchAreas() {}
+
+OTAStatus otaStatus;
+bool isOTAActive() { return false; }
+bool isOTAInProgress() { return false; }
+void displayOTAProgress() {}
+int getOTAProgress() { return 0; }
+String getOTAStatus() { return String("Bereit"); }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              DEMO-DATEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static void setSensor(int index, float value) {
+  SensorData& sensor = sensors[index];
+  sensor.lastValue = sensor.value;
+  sensor.value = value;
+  sensor.isTimedOut = false;
+  sensor.lastUpdate = millis();
+  sensor.trend = (value > sensor.lastValue) ? SensorData::UP :
+                 (value < sensor.lastValue) ? SensorData::DOWN : SensorData::STABLE;
+  sensor.formatValue();
+  sensor.hasChanged = true;
+  renderManager.markSensorChanged(index);
+}
+
+static void loadDemoScene() {
+  hostSetMillis(3600000UL);
+  hostSetLocalTime(14, 37, 5);
+  systemStartTime = 0;
+
+  initializeSensorLayouts();
+
+  stockReference = 24.10f;
+  stockPreviousClose = 24.50f;
+
+  pvPower = 6.4f;
+  gridPower = 1.2f;
+  loadPower = 3.1f;
+  storagePower = 2.1f;
+  wallboxPower = 0.0f;
+  isGridFeedIn = true;
+  isStorageCharging = true;
+
+  setSensor(0, 72.0f);
+  setSensor(1, 27.8f);
+  setSensor(2, 24.85f);
+  setSensor(3, 64.0f);
+  setSensor(4, loadPower);
+  setSensor(5, pvPower * 1000.0f);
+  setSensor(6, 11.5f);
+  setSensor(7, 48.0f);
+
+  // Typischer Tagesverlauf: günstig nachts und mittags, teuer am Abend
+  static const float demoPrices[24] = {
+    24.1f, 23.5f, 22.8f, 22.4f, 22.9f, 24.6f, 28.3f, 31.7f, 30.2f, 27.4f, 24.0f, 21.3f,
+    19.8f, 19.2f, 20.5f, 23.1f, 27.9f, 33.6f, 36.2f, 34.8f, 31.0f, 28.4f, 26.2f, 25.0f
+  };
+  dayAheadPrices.clear();
+  for (int h = 0; h < 24; h++) {
+    dayAheadPrices.prices[h].price = demoPrices[h];
+    dayAheadPrices.prices[h].isValid = true;
+    snprintf(dayAheadPrices.prices[h].hour, sizeof(dayAheadPrices.prices[h].hour), "%02d:00", h);
+  }
+  strcpy(dayAheadPrices.date, "15.01.2025");
+  dayAheadPrices.hasData = true;
+  dayAheadPrices.lastUpdate = millis() - 120000UL;
+  dayAheadPrices.calculateAnalytics();
+
+  systemStatus.wifiConnected = true;
+  systemStatus.mqttConnected = true;
+  systemStatus.wifiRSSI = -58;
+  systemStatus.freeHeap = 182000;
+  systemStatus.cpuUsageSmoothed = 23.0f;
+  systemStatus.uptime = 3600;
+  systemStatus.ldrValue = 1450;
+  systemStatus.ldrValueSmoothed = 1450;
+  systemStatus.updateTime();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RENDERING
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct HostScreen {
+  DisplayMode mode;
+  const char* name;
+};
+
+static const HostScreen HOST_SCREENS[] = {
+  {HOME_SCREEN, "home"},
+  {PRICE_DETAIL_SCREEN, "price_detail"},
+  {OEKOSTROM_DETAIL_SCREEN, "oekostrom_detail"},
+  {WALLBOX_CONSUMPTION_SCREEN, "wallbox"},
+  {LADESTAND_SCREEN, "ladestand"},
+  {SETTINGS_SCREEN, "settings"},
+  {DAYAHEAD_SCREEN, "dayahead"},
+};
+
+// Panel löschen wie nach fremdem Zeichnen; zählt nicht zu den Kosten des
+// Renderers (Zähler erst danach zurücksetzen)
+static void prepareFullFrame(DisplayMode mode) {
+  currentMode = mode;
+  tft.fillScreen(Colors::BG_MAIN);
+  renderManager.markPanelOverwritten();
+}
+
+static void renderScreen(DisplayMode mode) {
+  prepareFullFrame(mode);
+  updateDisplay();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              BENCHMARK: SENSOR-ZUSTÄNDE
+// ═══════════════════════════════════════════════════════════════════════════════
+// Jeder Zustand setzt auf der Demo-Szene auf (loadDemoScene vorher).
+
+static void stateDemo() {}
+
+// Nacht: keine PV, Netzbezug, Speicher entlädt, Auto lädt, Börse geschlossen
+static void stateNight() {
+  hostSetLocalTime(22, 15, 40);
+  pvPower = 0.0f;
+  gridPower = 9.6f;
+  loadPower = 11.9f;
+  storagePower = 2.3f;
+  wallboxPower = 7.4f;
+  isGridFeedIn = false;
+  isStorageCharging = false;
+  setSensor(0, 38.0f);
+  setSensor(3, 21.0f);
+  setSensor(4, loadPower);
+  setSensor(5, 0.0f);
+  setSensor(6, -4.5f);
+  systemStatus.updateTime();
+}
+
+// Mittagsspitze: volle PV, Speicher lädt, negative Preise, voller Akku
+static void statePeak() {
+  hostSetLocalTime(12, 5, 0);
+  pvPower = 14.8f;
+  gridPower = 6.1f;
+  loadPower = 2.4f;
+  storagePower = 6.3f;
+  wallboxPower = 0.0f;
+  isGridFeedIn = true;
+  isStorageCharging = true;
+  setSensor(0, 100.0f);
+  setSensor(2, -1.25f);
+  setSensor(3, 100.0f);
+  setSensor(4, loadPower);
+  setSensor(5, pvPower * 1000.0f);
+  setSensor(7, 61.0f);
+  for (int h = 10; h < 15; h++) dayAheadPrices.prices[h].price = -2.0f - h;
+  dayAheadPrices.calculateAnalytics();
+  systemStatus.updateTime();
+}
+
+// Alles ausgefallen: Sensor-Timeouts, kein Netz, keine Day-Ahead-Daten
+static void stateOffline() {
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    sensors[i].isTimedOut = true;
+    sensors[i].formatValue();
+    renderManager.markSensorChanged(i);
+  }
+  dayAheadPrices.clear();
+  systemStatus.wifiConnected = false;
+  systemStatus.mqttConnected = false;
+  systemStatus.wifiRSSI = -95;
+  systemStatus.freeHeap = 41000;
+}
+
+struct HostState {
+  const char* name;
+  void (*apply)();
+};
+
+// Teil-Updates: nach einem Vollbild ändern sich einzelne Werte, gemessen
+// wird nur der Folge-Frame (Dirty-Rechtecke, Kachel-Cache, Display-Listen)
+static void updateHomeValues() {
+  setSensor(2, sensors[2].value + 0.35f);
+  setSensor(4, sensors[4].value + 0.6f);
+  setSensor(6, sensors[6].value - 1.0f);
+}
+
+static void updatePriceValue() {
+  setSensor(1, sensors[1].value + 1.4f);
+  hostAdvanceMillis(60000UL);   // Alter der Day-Ahead-Daten
+}
+
+struct HostUpdate {
+  DisplayMode mode;
+  const char* name;
+  void (*change)();
+};
+
+static const HostUpdate HOST_UPDATES[] = {
+  {HOME_SCREEN, "home_update", updateHomeValues},
+  {PRICE_DETAIL_SCREEN, "price_update", updatePriceValue},
+};
+
+static const HostState HOST_STATES[] = {
+  {"demo", stateDemo},
+  {"night", stateNight},
+  {"peak", statePeak},
+  {"offline", stateOffline},
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              BENCHMARK: MESSEN UND VERGLEICHEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace HostBenchConfig {
+  constexpr int RUNS = 5;                      // Median der Renderzeit
+  constexpr int COUNT_TOLERANCE_PERCENT = 2;   // Pixel und SPI-Bytes (deterministisch)
+  constexpr int TIME_TOLERANCE_PERCENT = 50;   // relative Zeit, Host-CPU schwankt
+  constexpr long TIME_SLACK_US = 300;          // darunter kein Urteil
+  constexpr int CALIBRATION_RUNS = 9;          // Median der Kalibrierung
+  constexpr int CALIBRATION_PASSES = 10;       // Framebuffer-Hashes je Lauf
+}
+
+struct BenchResult {
+  std::string state, screen;
+  uint32_t hash = 0;
+  unsigned long pixels = 0;
+  unsigned long bytes = 0;
+  long micros = 0;
+  long relative = 0;   // Zeit in Promille der Kalibrierung (Manifest)
+};
+
+// Rechnerunabhängige Zeitbasis: feste CPU-Last ohne Renderer-Code (Hash über
+// einen Vollbild-Framebuffer), Median in Mikrosekunden. Das Manifest speichert
+// Zeiten relativ dazu, so vergleichen sich Läufe auf verschiedenen Rechnern.
+static long calibrationMicros() {
+  std::vector<uint16_t> buffer((size_t)Layout::DISPLAY_WIDTH * Layout::DISPLAY_HEIGHT);
+  for (size_t i = 0; i < buffer.size(); i++) buffer[i] = (uint16_t)(i * 2654435761u >> 16);
+
+  long times[HostBenchConfig::CALIBRATION_RUNS];
+  volatile uint32_t sink = 0;
+  for (int run = 0; run < HostBenchConfig::CALIBRATION_RUNS; run++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < HostBenchConfig::CALIBRATION_PASSES; pass++) {
+      buffer[pass] ^= 1;
+      sink = sink + framebufferHash(buffer);
+    }
+    times[run] = (long)std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start).count();
+  }
+  std::sort(times, times + HostBenchConfig::CALIBRATION_RUNS);
+  return std::max(1L, times[HostBenchConfig::CALIBRATION_RUNS / 2]);
+}
+
+// Misst einen Screen als Vollbild oder - mit 'update' - den Frame nach der
+// Änderung einzelner Werte
+static BenchResult measureScreen(const HostState& state, DisplayMode mode, const char* name,
+                                 void (*update)(), bool& stable) {
+  BenchResult result;
+  result.state = state.name;
+  result.screen = name;
+
+  long times[HostBenchConfig::RUNS];
+  for (int run = 0; run < HostBenchConfig::RUNS; run++) {
+    // Trends hängen vom vorherigen Wert ab: jeder Lauf startet bei null
+    for (SensorData& sensor : sensors) sensor = SensorData();
+    loadDemoScene();
+    state.apply();
+    renderManager.clearAllFlags();
+    if (update != nullptr) {
+      renderScreen(mode);
+      renderManager.clearAllFlags();
+      update();
+    } else {
+      prepareFullFrame(mode);
+    }
+
+    // Gemessen wird nur der Frame selbst
+    tft.hostResetCounters();
+    uint32_t bytesBefore = tft.bytesPushed();
+    auto start = std::chrono::steady_clock::now();
+    updateDisplay();
+    times[run] = (long)std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start).count();
+
+    uint32_t hash = framebufferHash(tft.hostFramebuffer());
+    if (run == 0) {
+      result.hash = hash;
+      result.pixels = tft.hostPixelsWritten();
+      result.bytes = tft.bytesPushed() - bytesBefore;
+    } else if (hash != result.hash) {
+      stable = false;   // gleicher Zustand, anderes Bild: Cache-Fehler
+    }
+  }
+
+  std::sort(times, times + HostBenchConfig::RUNS);
+  result.micros = times[HostBenchConfig::RUNS / 2];
+  return result;
+}
+
+static bool loadManifest(const char* path, std::vector<BenchResult>& entries) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return false;
+
+  char line[256];
+  while (fgets(line, sizeof(line), file)) {
+    if (line[0] == '#' || line[0] == '\n') continue;
+    char state[32], screen[32];
+    BenchResult entry;
+    if (sscanf(line, "%31s %31s %x %lu %lu %ld", state, screen, &entry.hash,
+               &entry.pixels, &entry.bytes, &entry.relative) == 6) {
+      entry.state = state;
+      entry.screen = screen;
+      entries.push_back(entry);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+static bool writeManifest(const char* path, const std::vector<BenchResult>& results, long calibration) {
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) return false;
+
+  fprintf(file, "# Host-Benchmark: program --bench %s [--update]\n", path);
+  fprintf(file, "# zustand screen hash pixel spi_bytes zeit_rel (Median aus %d Läufen, Promille der\n", HostBenchConfig::RUNS);
+  fprintf(file, "# Kalibrierung; beim Anlegen %ld us)\n", calibration);
+  for (const BenchResult& r : results) {
+    fprintf(file, "%s %s %08x %lu %lu %ld\n", r.state.c_str(), r.screen.c_str(),
+            r.hash, r.pixels, r.bytes, r.relative);
+  }
+  fclose(file);
+  return true;
+}
+
+static const BenchResult* findEntry(const std::vector<BenchResult>& entries, const BenchResult& result) {
+  for (const BenchResult& entry : entries) {
+    if (entry.state == result.state && entry.screen == result.screen) return &entry;
+  }
+  return nullptr;
+}
+
+static long percentChange(long now, long before) {
+  return before > 0 ? (now - before) * 100 / before : 0;
+}
+
+// Bild eines Falls als PPM ins Referenzverzeichnis (--update --reference)
+static bool writeReference(const char* dir, const char* name) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.ppm", dir, name);
+  return writePPM(path, tft.hostFramebuffer(), tft.width(), tft.height());
+}
+
+// Geändertes Bild: altes Bild aus dem Referenzverzeichnis daneben legen und
+// ein Differenzbild schreiben (geänderte Pixel magenta, Rest abgedunkelt)
+static void writeImageDiff(const char* referenceDir, const char* outDir, const char* name) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.ppm", referenceDir, name);
+  std::vector<uint16_t> before;
+  int width = 0, height = 0;
+  if (!readPPM(path, before, width, height) || width != tft.width() || height != tft.height()) {
+    printf("         kein Referenzbild %s - auf dem Stand des Manifests mit --update --reference %s anlegen\n",
+           path, referenceDir);
+    return;
+  }
+
+  const std::vector<uint16_t>& after = tft.hostFramebuffer();
+  std::vector<uint16_t> diff(before.size());
+  DirtyRect changed;
+  long count = 0;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      size_t i = (size_t)y * width + x;
+      if (before[i] == after[i]) {
+        diff[i] = (before[i] >> 2) & 0x39E7;   // jeder Kanal auf ein Viertel
+        continue;
+      }
+      diff[i] = 0xF81F;
+      changed = changed.unionWith(DirtyRect(x, y, 1, 1));
+      count++;
+    }
+  }
+
+  snprintf(path, sizeof(path), "%s/%s_alt.png", outDir, name);
+  writePNG(path, before, width, height);
+  snprintf(path, sizeof(path), "%s/%s_diff.png", outDir, name);
+  writePNG(path, diff, width, height);
+  printf("         %ld Pixel geändert in (%d,%d %dx%d): %s/%s_alt.png, _neu.png, _diff.png\n",
+         count, changed.x, changed.y, changed.w, changed.h, outDir, name);
+}
+
+static int runBenchmark(const char* manifest, bool update, bool timing, const char* outDir,
+                        const char* referenceDir) {
+  std::vector<BenchResult> golden;
+  if (!update && !loadManifest(manifest, golden)) {
+    printf("Manifest %s fehlt - erst mit --update anlegen\n", manifest);
+    return 1;
+  }
+
+  long calibration = calibrationMicros();
+  std::vector<BenchResult> results;
+  int failures = 0;
+
+  printf("Kalibrierung: %ld us (Zeit rel. = Promille davon)\n", calibration);
+  printf("%-8s %-18s %-9s %8s %9s %8s %6s %8s  %s\n",
+         "Zustand", "Screen", "Hash", "Pixel", "SPI-Byte", "Zeit", "rel.", "Δ rel.", "Ergebnis");
+  // Vollbilder aller Screens, dann die Teil-Updates
+  struct BenchCase {
+    DisplayMode mode;
+    const char* name;
+    void (*update)();
+  };
+  std::vector<BenchCase> cases;
+  for (const HostScreen& screen : HOST_SCREENS) cases.push_back({screen.mode, screen.name, nullptr});
+  for (const HostUpdate& update : HOST_UPDATES) cases.push_back({update.mode, update.name, update.change});
+
+  for (const HostState& state : HOST_STATES) {
+    for (const BenchCase& benchCase : cases) {
+      bool stable = true;
+      BenchResult result = measureScreen(state, benchCase.mode, benchCase.name, benchCase.update, stable);
+      result.relative = result.micros * 1000 / calibration;
+      results.push_back(result);
+
+      char name[96];
+      snprintf(name, sizeof(name), "%s_%s", state.name, benchCase.name);
+      if (update && referenceDir != nullptr && !writeReference(referenceDir, name)) {
+        printf("Referenzbild %s/%s.ppm konnte nicht geschrieben werden\n", referenceDir, name);
+        return 1;
+      }
+
+      const char* verdict = "OK";
+      long timeChange = 0;
+      const BenchResult* expected = update ? nullptr : findEntry(golden, result);
+      if (!stable) {
+        verdict = "INSTABIL";
+      } else if (!update && expected == nullptr) {
+        verdict = "NEU";
+      } else if (expected != nullptr) {
+        // Erwartete Zeit auf diesem Rechner (für die absolute Untergrenze)
+        long expectedMicros = expected->relative * calibration / 1000;
+        timeChange = percentChange(result.relative, expected->relative);
+        if (result.hash != expected->hash) {
+          verdict = "BILD";
+        } else if (percentChange(result.bytes, expected->bytes) > HostBenchConfig::COUNT_TOLERANCE_PERCENT) {
+          verdict = "SPI";
+        } else if (percentChange(result.pixels, expected->pixels) > HostBenchConfig::COUNT_TOLERANCE_PERCENT) {
+          verdict = "PIXEL";
+        } else if (timing && timeChange > HostBenchConfig::TIME_TOLERANCE_PERCENT &&
+                   result.micros - expectedMicros > HostBenchConfig::TIME_SLACK_US) {
+          verdict = "ZEIT";
+        }
+      }
+
+      bool failed = strcmp(verdict, "OK") != 0;
+      printf("%-8s %-18s %08x %8lu %9lu %8ld %6ld %+7ld%%  %s\n", state.name, benchCase.name,
+             result.hash, result.pixels, result.bytes, result.micros, result.relative, timeChange, verdict);
+      if (failed) {
+        failures++;
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s_neu.png", outDir, name);
+        writePNG(path, tft.hostFramebuffer(), tft.width(), tft.height());
+        if (expected != nullptr && result.hash != expected->hash) {
+          printf("         Manifest: %s %s %08x %lu %lu %ld -> Hash jetzt %08x\n",
+                 expected->state.c_str(), expected->screen.c_str(), expected->hash,
+                 expected->pixels, expected->bytes, expected->relative, result.hash);
+          if (referenceDir != nullptr) {
+            writeImageDiff(referenceDir, outDir, name);
+          } else {
+            printf("         altes Bild: auf dem Stand des Manifests mit --update --reference <dir> anlegen,\n"
+                   "         dann hier mit --reference <dir> vergleichen\n");
+          }
+        }
+      }
+    }
+  }
+
+  if (update) {
+    if (!writeManifest(manifest, results, calibration)) {
+      printf("Manifest %s konnte nicht geschrieben werden\n", manifest);
+      return 1;
+    }
+    printf("Manifest %s mit %d Einträgen geschrieben\n", manifest, (int)results.size());
+    return failures > 0 ? 1 : 0;
+  }
+
+  printf("%d von %d Fällen abweichend%s\n", failures, (int)results.size(),
+         timing ? "" : " (ohne Zeitprüfung)");
+  return failures > 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  if (getenv("HOST_VERBOSE")) Serial.setQuiet(false);
+
+  tft.init();
+  tft.setRotation(1);
+
+  if (argc > 2 && strcmp(argv[1], "--bench") == 0) {
+    const char* manifest = argv[2];
+    bool update = false, timing = true;
+    const char* benchOutDir = ".";
+    const char* referenceDir = nullptr;
+    for (int i = 3; i < argc; i++) {
+      if (strcmp(argv[i], "--update") == 0) update = true;
+      else if (strcmp(argv[i], "--no-timing") == 0) timing = false;
+      else if (strcmp(argv[i], "--reference") == 0 && i + 1 < argc) referenceDir = argv[++i];
+      else benchOutDir = argv[i];
+    }
+    return runBenchmark(manifest, update, timing, benchOutDir, referenceDir);
+  }
+
+  const char* outDir = (argc > 1) ? argv[1] : ".";
+  loadDemoScene();
+
+  printf("%-18s %-6s %10s %10s  %s\n", "Screen", "Datei", "Pixel", "Zeit [us]", "Hash");
+  for (const HostScreen& screen : HOST_SCREENS) {
+    prepareFullFrame(screen.mode);
+    tft.hostResetCounters();
+    auto start = std::chrono::steady_clock::now();
+    updateDisplay();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start).count();
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", outDir, screen.name);
+    bool ok = writePPM(path, tft.hostFramebuffer(), tft.width(), tft.height());
+    snprintf(path, sizeof(path), "%s/%s.png", outDir, screen.name);
+    ok = writePNG(path, tft.hostFramebuffer(), tft.width(), tft.height()) && ok;
+
+    printf("%-18s %-6s %10lu %10lld  %08x\n", screen.name, ok ? "OK" : "FEHLER",
+           tft.hostPixelsWritten(), (long long)duration, framebufferHash(tft.hostFramebuffer()));
+    if (!ok) return 1;
+  }
+
+  // Profil der Zeichenfunktionen (Zeit auf Host-CPU, SPI-Bytes wie auf dem Gerät)
+  if (getenv("HOST_PROFILE")) {
+    Serial.setQuiet(false);
+    logRenderProfile();
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+#include "image_writer.h"
+#include <cstdio>
+#include <algorithm>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              HILFSFUNKTIONEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void rgb565ToRgb888(uint16_t color, uint8_t* rgb) {
+  uint8_t r = (color >> 11) & 0x1F;
+  uint8_t g = (color >> 5) & 0x3F;
+  uint8_t b = color & 0x1F;
+  rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+  rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+  rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+  static uint32_t table[256];
+  static bool tableReady = false;
+  if (!tableReady) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : (c >> 1);
+      table[n] = c;
+    }
+    tableReady = true;
+  }
+  for (size_t i = 0; i < len; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return crc;
+}
+
+static void putBE32(std::vector<uint8_t>& out, uint32_t v) {
+  out.push_back((uint8_t)(v >> 24));
+  out.push_back((uint8_t)(v >> 16));
+  out.push_back((uint8_t)(v >> 8));
+  out.push_back((uint8_t)v);
+}
+
+static void writeChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> chunk;
+  putBE32(chunk, (uint32_t)data.size());
+  chunk.insert(chunk.end(), type, type + 4);
+  chunk.insert(chunk.end(), data.begin(), data.end());
+  uint32_t crc = crc32Update(0xFFFFFFFFu, chunk.data() + 4, chunk.size() - 4) ^ 0xFFFFFFFFu;
+  putBE32(chunk, crc);
+  fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              PPM / PNG
+// ═══════════════════════════════════════════════════════════════════════════════
+
+bool writePPM(const char* path, const std::vector<uint16_t>& framebuffer, int width, int height) {
+  if ((int)framebuffer.size() < width * height) return false;
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", width, height);
+  std::vector<uint8_t> row((size_t)width * 3);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      rgb565ToRgb888(framebuffer[(size_t)y * width + x], &row[(size_t)x * 3]);
+    }
+    fwrite(row.data(), 1, row.size(), f);
+  }
+  return fclose(f) == 0;
+}
+
+bool readPPM(const char* path, std::vector<uint16_t>& framebuffer, int& width, int& height) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+
+  int maxValue = 0;
+  bool ok = fscanf(f, "P6 %d %d %d", &width, &height, &maxValue) == 3 && maxValue == 255 &&
+            width > 0 && height > 0 && fgetc(f) != EOF;
+  if (ok) {
+    framebuffer.assign((size_t)width * height, 0);
+    std::vector<uint8_t> row((size_t)width * 3);
+    for (int y = 0; ok && y < height; y++) {
+      ok = fread(row.data(), 1, row.size(), f) == row.size();
+      for (int x = 0; ok && x < width; x++) {
+        const uint8_t* rgb = &row[(size_t)x * 3];
+        framebuffer[(size_t)y * width + x] = (uint16_t)(((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3));
+      }
+    }
+  }
+  fclose(f);
+  return ok;
+}
+
+bool writePNG(const char* path, const std::vector<uint16_t>& framebuffer, int width, int height) {
+  if ((int)framebuffer.size() < width * height) return false;
+
+  // Rohdaten: je Zeile ein Filterbyte (0 = None) + RGB
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)height * (width * 3 + 1));
+  for (int y = 0; y < height; y++) {
+    raw.push_back(0);
+    for (int x = 0; x < width; x++) {
+      uint8_t rgb[3];
+      rgb565ToRgb888(framebuffer[(size_t)y * width + x], rgb);
+      raw.insert(raw.end(), rgb, rgb + 3);
+    }
+  }
+
+  // zlib-Strom aus "stored"-Blöcken (max. 65535 Bytes je Block)
+  std::vector<uint8_t> zlib = {0x78, 0x01};
+  size_t pos = 0;
+  do {
+    size_t len = std::min<size_t>(65535, raw.size() - pos);
+    bool last = (pos + len == raw.size());
+    zlib.push_back(last ? 1 : 0);
+    zlib.push_back((uint8_t)(len & 0xFF));
+    zlib.push_back((uint8_t)(len >> 8));
+    zlib.push_back((uint8_t)(~len & 0xFF));
+    zlib.push_back((uint8_t)((~len >> 8) & 0xFF));
+    zlib.insert(zlib.end(), raw.begin() + pos, raw.begin() + pos + len);
+    pos += len;
+  } while (pos < raw.size());
+
+  uint32_t a = 1, b = 0;
+  for (uint8_t v : raw) {
+    a = (a + v) % 65521;
+    b = (b + a) % 65521;
+  }
+  putBE32(zlib, (b << 16) | a);
+
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+
+  static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+  fwrite(signature, 1, sizeof(signature), f);
+
+  std::vector<uint8_t> ihdr;
+  putBE32(ihdr, (uint32_t)width);
+  putBE32(ihdr, (uint32_t)height);
+  ihdr.push_back(8);  // Bittiefe
+  ihdr.push_back(2);  // Farbtyp RGB
+  ihdr.push_back(0);  // Kompression
+  ihdr.push_back(0);  // Filter
+  ihdr.push_back(0);  // kein Interlace
+  writeChunk(f, "IHDR", ihdr);
+  writeChunk(f, "IDAT", zlib);
+  writeChunk(f, "IEND", std::vector<uint8_t>());
+
+  return fclose(f) == 0;
+}
+
+uint32_t framebufferHash(const std::vector<uint16_t>& framebuffer) {
+  uint32_t hash = 2166136261u;
+  for (uint16_t px : framebuffer) {
+    hash = (hash ^ (px & 0xFF)) * 16777619u;
+    hash = (hash ^ (px >> 8)) * 16777619u;
+  }
+  return hash;
+}
@@ -0,0 +1,26 @@
+#ifndef HOST_IMAGE_WRITER_H
+#define HOST_IMAGE_WRITER_H
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                    HOST-SHIM: FRAMEBUFFER ALS PPM/PNG SPEICHERN
+// ═══════════════════════════════════════════════════════════════════════════════
+// Beide Formate kommen ohne externe Bibliotheken aus. PNG nutzt unkomprimierte
+// Deflate-Blöcke ("stored"), die Dateien sind daher so groß wie das Rohbild.
+
+#include <cstdint>
+#include <vector>
+
+// RGB565 -> RGB888 (volle 8-Bit-Skala)
+void rgb565ToRgb888(uint16_t color, uint8_t* rgb);
+
+bool writePPM(const char* path, const std::vector<uint16_t>& framebuffer, int width, int height);
+bool writePNG(const char* path, const std::vector<uint16_t>& framebuffer, int width, int height);
+
+// Liest eine von writePPM geschriebene Datei zurück (RGB888 -> RGB565 ist
+// für diese Dateien verlustfrei). false bei fehlender oder fremder Datei.
+bool readPPM(const char* path, std::vector<uint16_t>& framebuffer, int& width, int& height);
+
+// FNV-1a über den Framebuffer (für Golden-Vergleiche)
+uint32_t framebufferHash(const std::vector<uint16_t>& framebuffer);
+
+#endif // HOST_IMAGE_WRITER_H
@@ -0,0 +1,97 @@
+#include "backlight.h"
+#include <TFT_eSPI.h>   // TFT_BL aus dem User-Setup
+
+BacklightStats backlightStats;
+
+#ifdef TFT_BL
+static constexpr int BACKLIGHT_PIN = TFT_BL;
+#else
+static constexpr int BACKLIGHT_PIN = -1;   // Host-Build, Panel ohne Steuerpin
+#endif
+
+static bool pwmAttached = false;
+static bool nightMode = false;
+static bool roomDark = false;
+static unsigned long darkSince = 0;
+static bool woken = false;                 // Berührung setzt den Nachtmodus aus
+static unsigned long wokenAt = 0;
+
+static void writeDuty(int duty) {
+  if (duty == backlightStats.duty) return;
+  backlightStats.duty = duty;
+  backlightStats.dutyWrites++;
+  if (pwmAttached) ledcWrite(BacklightConfig::LEDC_CHANNEL, duty);
+}
+
+// Umgebungshelligkeit in Promille aus dem LDR-Rohwert
+static int ambientLevel(int ldr) {
+  long level = (long)(ldr - BacklightConfig::LDR_DARK) * 1000 /
+               (BacklightConfig::LDR_BRIGHT - BacklightConfig::LDR_DARK);
+  return constrain(level, 0L, 1000L);
+}
+
+// Quadratisch: bei wenig Umgebungslicht fein abgestuft, wie das Auge
+static int dutyForLevel(int level) {
+  long span = BacklightConfig::MAX_DUTY - BacklightConfig::MIN_DUTY;
+  return BacklightConfig::MIN_DUTY + (int)(span * level * level / 1000000L);
+}
+
+static void setNightMode(bool night) {
+  if (night == nightMode) return;
+  nightMode = night;
+  if (night) backlightStats.nightEntries++;
+
+  renderManager.telemetryDeadlineMs = night ? Timing::FRAME_DEADLINE_NIGHT
+                                            : Timing::FRAME_DEADLINE_TELEMETRY;
+  // Bereits gesammelte Änderungen nicht bis zur Nacht-Deadline liegen lassen
+  if (!night && renderManager.frameScheduled) {
+    renderManager.scheduleFrame(Timing::FRAME_DEADLINE_TELEMETRY);
+  }
+  Serial.printf("🌙 Nachtmodus %s (Pegel %d‰)\n", night ? "an" : "aus", backlightStats.level);
+}
+
+void initBacklight() {
+  if (!BacklightConfig::ENABLED || BACKLIGHT_PIN < 0) return;
+  ledcSetup(BacklightConfig::LEDC_CHANNEL, BacklightConfig::PWM_FREQUENCY, BacklightConfig::PWM_BITS);
+  ledcAttachPin(BACKLIGHT_PIN, BacklightConfig::LEDC_CHANNEL);
+  ledcWrite(BacklightConfig::LEDC_CHANNEL, backlightStats.duty);
+  pwmAttached = true;
+}
+
+void updateBacklight(int ldrSmoothed, unsigned long now) {
+  if (!BacklightConfig::ENABLED) return;
+
+  int level = ambientLevel(ldrSmoothed);
+  backlightStats.level = level;
+
+  // Nachtmodus: erst nach NIGHT_ENTER_MS Dunkelheit, sofort zurück bei Licht.
+  // Zwischen beiden Pegeln bleibt der bisherige Zustand (Hysterese).
+  if (level >= BacklightConfig::NIGHT_EXIT_LEVEL) {
+    roomDark = false;
+  } else if (level <= BacklightConfig::NIGHT_ENTER_LEVEL && !roomDark) {
+    roomDark = true;
+    darkSince = now;
+  }
+  if (woken && now - wokenAt >= BacklightConfig::WAKE_MS) woken = false;
+  setNightMode(roomDark && !woken && now - darkSince >= BacklightConfig::NIGHT_ENTER_MS);
+
+  int target = nightMode ? BacklightConfig::NIGHT_DUTY : dutyForLevel(level);
+  int step = constrain(target - backlightStats.duty, -BacklightConfig::MAX_STEP, BacklightConfig::MAX_STEP);
+  writeDuty(backlightStats.duty + step);
+}
+
+void wakeBacklight(unsigned long now) {
+  if (!BacklightConfig::ENABLED) return;
+  woken = true;
+  wokenAt = now;
+  if (!nightMode) return;
+
+  // Sofort hell, ohne Rampe: der Nutzer will etwas sehen
+  backlightStats.wakeups++;
+  setNightMode(false);
+  writeDuty(dutyForLevel(backlightStats.level));
+}
+
+bool isNightMode() {
+  return nightMode;
+}
@@ -0,0 +1,68 @@
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+extern RenderManager renderManager;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              HINTERGRUNDBELEUCHTUNG
+// ═══════════════════════════════════════════════════════════════════════════════
+// TFT_BL wird per LEDC-PWM gedimmt. Die Helligkeit folgt dem geglätteten
+// LDR-Wert (alle 2 s aus updateSystemStatus) über eine quadratische Kurve,
+// Sprünge werden pro Messung auf MAX_STEP begrenzt. Bleibt der Raum länger
+// dunkel, schaltet der Nachtmodus die Beleuchtung fast aus und streckt die
+// Telemetrie-Deadline des RenderManagers (auch Uhr, Netzwerkstatus, HUD).
+// Eine Berührung weckt das Display für WAKE_MS auf volle Kurvenhelligkeit.
+
+namespace BacklightConfig {
+  constexpr bool ENABLED = true;                 // false: TFT_BL bleibt wie von TFT_eSPI gesetzt
+  constexpr uint8_t LEDC_CHANNEL = 7;
+  constexpr uint32_t PWM_FREQUENCY = 5000;       // Hz, oberhalb sichtbaren Flimmerns
+  constexpr uint8_t PWM_BITS = 10;
+  constexpr int MAX_DUTY = (1 << PWM_BITS) - 1;
+
+  // LDR-Rohwerte für "dunkel" und "hell" (am Gerät in der Systemzeile ablesen).
+  // Die Richtung ist egal: der Pegel wird linear zwischen beiden interpoliert.
+  constexpr int LDR_DARK = 1800;
+  constexpr int LDR_BRIGHT = 200;
+
+  constexpr int MIN_DUTY = 120;                  // dunkelster Tagwert
+  constexpr int NIGHT_DUTY = 8;                  // nahezu aus
+  constexpr int MAX_STEP = 48;                   // pro Messung (2 s)
+
+  // Nachtmodus mit Hysterese, Pegel in Promille
+  constexpr int NIGHT_ENTER_LEVEL = 40;
+  constexpr int NIGHT_EXIT_LEVEL = 120;
+  constexpr unsigned long NIGHT_ENTER_MS = 60000;   // so lange dunkel vor dem Umschalten
+  constexpr unsigned long WAKE_MS = 30000;          // nach Berührung
+
+  static_assert(LDR_DARK != LDR_BRIGHT, "LDR-Kalibrierung braucht zwei verschiedene Werte");
+  static_assert(NIGHT_DUTY < MIN_DUTY && MIN_DUTY < MAX_DUTY, "Helligkeitsstufen ungeordnet");
+  static_assert(NIGHT_ENTER_LEVEL < NIGHT_EXIT_LEVEL, "Nachtmodus braucht Hysterese");
+}
+
+// Nach tft.init(): übernimmt TFT_BL auf den LEDC-Kanal (volle Helligkeit)
+void initBacklight();
+
+// Mit jeder LDR-Messung: Zielhelligkeit nachführen, Nachtmodus umschalten
+void updateBacklight(int ldrSmoothed, unsigned long now);
+
+// Berührung: Nachtmodus für WAKE_MS aussetzen
+void wakeBacklight(unsigned long now);
+
+bool isNightMode();
+
+// Statistik
+struct BacklightStats {
+  int duty = BacklightConfig::MAX_DUTY;     // aktuell gesetzt
+  int level = 1000;                         // Umgebungshelligkeit in Promille
+  unsigned long dutyWrites = 0;
+  unsigned long nightEntries = 0;
+  unsigned long wakeups = 0;                // Berührung im Nachtmodus
+};
+
+extern BacklightStats backlightStats;
+
+#endif // BACKLIGHT_H
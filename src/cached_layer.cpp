@@ -0,0 +1,105 @@
+#include "cached_layer.h"
+
+CachedLayerStats cachedLayerStats;
+
+constexpr uint16_t LENGTH_MASK = (1 << CachedLayerConfig::LENGTH_BITS) - 1;
+
+CachedLayer::CachedLayer(uint16_t* runStorage, int capacity) : runs(runStorage), capacity(capacity) {
+  clear();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              AUFNAHME
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void CachedLayer::clear() {
+  count = 0;
+  paletteCount = 0;
+  capturedRows = 0;
+  overflow = false;
+  valid = false;
+  layerKey = 0;
+  rowStart[0] = 0;
+}
+
+void CachedLayer::beginCapture(uint32_t key) {
+  clear();
+  layerKey = key;
+}
+
+// Index der Farbe in der Palette, neu aufgenommen falls nötig; -1 wenn voll
+int CachedLayer::paletteIndex(uint16_t color) {
+  for (int i = 0; i < paletteCount; i++) {
+    if (palette[i] == color) return i;
+  }
+  if (paletteCount >= CachedLayerConfig::PALETTE_SIZE) return -1;
+  palette[paletteCount] = color;
+  return paletteCount++;
+}
+
+void CachedLayer::appendRows(TFT_eSprite& band, int firstRow, int rows) {
+  if (overflow || firstRow != capturedRows || band.getColorDepth() != 16) {
+    overflow = true;
+    return;
+  }
+
+  const uint16_t* pixels = (const uint16_t*)band.getPointer();
+  int stride = band.width();
+  rows = min(rows, Layout::DISPLAY_HEIGHT - firstRow);
+
+  for (int row = 0; row < rows; row++) {
+    const uint16_t* line = pixels + row * stride;
+    int x = 0;
+    while (x < Layout::DISPLAY_WIDTH) {
+      uint16_t color = line[x];
+      int length = 1;
+      while (x + length < Layout::DISPLAY_WIDTH && line[x + length] == color) length++;
+
+      int index = paletteIndex(color);
+      if (index < 0 || count >= capacity) {
+        overflow = true;
+        return;
+      }
+      runs[count++] = (uint16_t)((index << CachedLayerConfig::LENGTH_BITS) | length);
+      x += length;
+    }
+    rowStart[++capturedRows] = count;
+  }
+}
+
+bool CachedLayer::finishCapture() {
+  valid = !overflow && capturedRows == Layout::DISPLAY_HEIGHT;
+  captures++;
+  maxRuns = max(maxRuns, count);
+  if (overflow) overflows++;
+  return valid;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              AUSGABE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void CachedLayer::copyTo(TFT_eSprite& sprite, int32_t originX, int32_t originY, const DirtyRect& area) const {
+  if (!valid || sprite.getColorDepth() != 16) return;
+
+  // Auf Panel und Sprite beschneiden
+  int x0 = max(max((int)area.x, 0), (int)originX);
+  int y0 = max(max((int)area.y, 0), (int)originY);
+  int x1 = min(min(area.right(), Layout::DISPLAY_WIDTH), (int)(originX + sprite.width()));
+  int y1 = min(min(area.bottom(), Layout::DISPLAY_HEIGHT), (int)(originY + sprite.height()));
+  if (x1 <= x0 || y1 <= y0) return;
+
+  uint16_t* pixels = (uint16_t*)sprite.getPointer();
+  int stride = sprite.width();
+
+  for (int y = y0; y < y1; y++) {
+    uint16_t* out = pixels + (y - originY) * stride - originX;
+    int runX = 0;
+    for (int r = rowStart[y]; r < rowStart[y + 1] && runX < x1; r++) {
+      int runEnd = runX + (runs[r] & LENGTH_MASK);
+      uint16_t color = palette[runs[r] >> CachedLayerConfig::LENGTH_BITS];
+      for (int x = max(runX, x0); x < min(runEnd, x1); x++) out[x] = color;
+      runX = runEnd;
+    }
+  }
+}
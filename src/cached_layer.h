@@ -0,0 +1,95 @@
+#ifndef CACHED_LAYER_H
+#define CACHED_LAYER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              GECACHTE VOLLBILD-LAYER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Ein Vollbild als Lauflängen mit Palette: je Lauf 16 Bit (5 Bit Farbindex,
+// 11 Bit Länge). Die Screens bestehen fast nur aus einfarbigen Flächen und
+// wenigen Farben - statt 150 KB Framebuffer reichen einige tausend Läufe.
+// Sprites und Bänder werden aus dem Layer befüllt.
+//
+// Genutzt für die Chrome des Home-Screens (Hintergrund, Box-Flächen, Rahmen,
+// Labels) und für das zuletzt gezeichnete Home-Vollbild (Rückkehr per Blit).
+// Ein Layer gilt für einen Schlüssel (Hash über alles, was sein Bild
+// verändert, z.B. Anti-Burnin-Offset und Timeout-Zustände).
+
+namespace CachedLayerConfig {
+  constexpr bool ENABLED = true;
+  constexpr int LENGTH_BITS = 11;
+  constexpr int PALETTE_SIZE = 1 << (16 - LENGTH_BITS);   // 32 Farben
+  constexpr int CHROME_RUNS = 4096;   // 8 KB  (Home-Chrome: ~2800 Läufe)
+  constexpr int FRAME_RUNS = 8192;    // 16 KB (Home-Vollbild: ~5900 Läufe)
+  static_assert(Layout::DISPLAY_WIDTH < (1 << LENGTH_BITS), "Eine Zeile muss in einen Lauf passen");
+}
+
+class CachedLayer {
+public:
+  // Lauf-Speicher wird vom Aufrufer gestellt (statisches Array)
+  CachedLayer(uint16_t* runStorage, int capacity);
+
+  void clear();
+  bool isValid() const { return valid; }
+  bool matches(uint32_t key) const { return valid && layerKey == key; }
+  uint32_t key() const { return layerKey; }
+  int runCount() const { return count; }
+
+  // Aufnahme: Zeilen eines 16-Bit-Band-Sprites (ohne Viewport) der Reihe
+  // nach anhängen. finishCapture() liefert false bei Überlauf (zu viele
+  // Läufe oder Farben).
+  void beginCapture(uint32_t key);
+  void appendRows(TFT_eSprite& band, int firstRow, int rows);
+  bool finishCapture();
+
+  // Schreibt den Layer im Bereich 'area' (absolute Panel-Koordinaten) in
+  // einen 16-Bit-Sprite, dessen linke obere Ecke bei (originX, originY)
+  // liegt. Pixel außerhalb des Panels bleiben unverändert.
+  void copyTo(TFT_eSprite& sprite, int32_t originX, int32_t originY, const DirtyRect& area) const;
+
+  // Rohdaten ohne Kopie (Screenshots): die Läufe der Zeilen [firstRow,
+  // firstRow + rows) liegen zusammenhängend ab rowRuns(firstRow). Palette in
+  // Sprite-Byte-Reihenfolge.
+  const uint16_t* rowRuns(int row) const { return runs + rowStart[row]; }
+  int runCountOfRows(int firstRow, int rows) const { return rowStart[firstRow + rows] - rowStart[firstRow]; }
+  int paletteSize() const { return paletteCount; }
+  uint16_t paletteEntry(int index) const { return palette[index]; }
+
+  // Statistik
+  unsigned long captures = 0;
+  unsigned long overflows = 0;
+  int maxRuns = 0;
+
+private:
+  int paletteIndex(uint16_t color);
+
+  uint16_t* runs;                     // (Farbindex << LENGTH_BITS) | Länge
+  int capacity;
+  uint16_t palette[CachedLayerConfig::PALETTE_SIZE];   // Sprite-Byte-Reihenfolge
+  int paletteCount = 0;
+  uint16_t rowStart[Layout::DISPLAY_HEIGHT + 1];
+  int count = 0;
+  int capturedRows = 0;
+  bool overflow = false;
+  bool valid = false;
+  uint32_t layerKey = 0;
+};
+
+// Die Layer des Home-Screens (definiert in display.cpp)
+extern CachedLayer homeChromeLayer;   // Chrome: Hintergrund, Box-Flächen, Rahmen, Labels
+extern CachedLayer homeFrameLayer;    // zuletzt gezeichnetes Home-Vollbild
+
+// Nutzung
+struct CachedLayerStats {
+  unsigned long composedBoxes = 0;    // Sensor-Boxen aus der Chrome befüllt
+  unsigned long composedFrames = 0;   // Vollbilder aus Chrome + dynamischen Teilen
+  unsigned long restoredFrames = 0;   // Rückkehr zum Home-Screen per Blit
+  unsigned long restoredWidgets = 0;  // danach nachgezogene (geänderte) Widgets
+};
+
+extern CachedLayerStats cachedLayerStats;
+
+#endif // CACHED_LAYER_H
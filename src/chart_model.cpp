@@ -0,0 +1,115 @@
+#include "chart_model.h"
+#include "display.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              MODELL-AUFBAU
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static PriceChartModel chartModel;
+static int chartHour = -1;
+
+static uint16_t legacyBarColor(float price, float minPrice, float maxPrice) {
+  // Relativ zur Mitte der Spanne
+  float midPrice = (minPrice + maxPrice) / 2.0f;
+  if (price < midPrice * 0.8f) return Colors::STATUS_GREEN;   // Günstig
+  if (price > midPrice * 1.2f) return Colors::STATUS_RED;     // Teuer
+  return Colors::STATUS_YELLOW;                               // Mittel
+}
+
+static uint16_t analyticsBarColor(PriceCategory category) {
+  switch (category) {
+    case PRICE_VERY_CHEAP:     return Colors::STATUS_GREEN;
+    case PRICE_CHEAP:          return TFT_DARKGREEN;
+    case PRICE_MEDIUM:         return Colors::STATUS_BLUE;
+    case PRICE_EXPENSIVE:      return TFT_ORANGE;
+    case PRICE_VERY_EXPENSIVE: return Colors::STATUS_RED;
+    default:                   return Colors::TEXT_LABEL;
+  }
+}
+
+static uint16_t oekostromBarColor(float price, float minPrice, float priceRange) {
+  // Quartile der Spanne
+  if (price > (minPrice + priceRange * 0.75f)) return Colors::STATUS_RED;     // Teuer
+  if (price > (minPrice + priceRange * 0.5f))  return Colors::STATUS_ORANGE;  // Mittel
+  if (price > (minPrice + priceRange * 0.25f)) return Colors::STATUS_YELLOW;  // Günstig
+  return Colors::STATUS_GREEN;                                                // Sehr günstig
+}
+
+static void buildPriceChartModel(PriceChartModel& model) {
+  unsigned long rebuilds = model.rebuilds;
+  model = PriceChartModel();
+  model.built = true;
+  model.rebuilds = rebuilds + 1;
+  model.hasData = frameState.dayAheadPrices.hasData;
+  model.dataUpdate = frameState.dayAheadPrices.lastUpdate;
+  model.dataAnalysis = frameState.dayAheadPrices.lastAnalysis;
+
+  // Min/Max/Durchschnitt über alle gültigen Stunden
+  float minPrice = 999.0f;
+  float maxPrice = -999.0f;
+  float sum = 0.0f;
+
+  for (int i = 0; i < Layout::CHART_HOURS; i++) {
+    if (!frameState.dayAheadPrices.prices[i].isValid) continue;
+    float price = frameState.dayAheadPrices.prices[i].price;
+    minPrice = min(minPrice, price);
+    maxPrice = max(maxPrice, price);
+    sum += price;
+    model.valid[i] = true;
+    model.validCount++;
+  }
+
+  if (model.validCount > 0) {
+    model.minPrice = minPrice;
+    model.maxPrice = maxPrice;
+    model.avgPrice = sum / model.validCount;
+  }
+
+  float priceRange = model.maxPrice - model.minPrice;
+  float analyticsMin = frameState.dayAheadPrices.minPrice;
+  float analyticsRange = frameState.dayAheadPrices.maxPrice - analyticsMin;
+  model.analyticsRangeValid = analyticsRange > 0.0f;
+
+  for (int i = 0; i < Layout::CHART_HOURS; i++) {
+    if (!model.valid[i]) continue;
+    float price = frameState.dayAheadPrices.prices[i].price;
+
+    model.level[i] = priceRange > 0.0f ? (price - model.minPrice) / priceRange : 0.0f;
+    if (model.analyticsRangeValid) {
+      model.analyticsLevel[i] = (price - analyticsMin) / analyticsRange;
+    }
+
+    model.color[CHART_VIEW_LEGACY][i] = legacyBarColor(price, model.minPrice, model.maxPrice);
+    model.color[CHART_VIEW_ANALYTICS][i] = analyticsBarColor(frameState.dayAheadPrices.prices[i].category);
+    model.color[CHART_VIEW_OEKOSTROM][i] = oekostromBarColor(price, model.minPrice, priceRange);
+  }
+}
+
+const PriceChartModel& priceChartModel() {
+  if (!chartModel.built ||
+      chartModel.hasData != frameState.dayAheadPrices.hasData ||
+      chartModel.dataUpdate != frameState.dayAheadPrices.lastUpdate ||
+      chartModel.dataAnalysis != frameState.dayAheadPrices.lastAnalysis) {
+    buildPriceChartModel(chartModel);
+  }
+  return chartModel;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              AKTUELLE STUNDE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void updateChartClock() {
+  // Timeout 0: im Render-Pfad nicht auf SNTP warten
+  struct tm timeinfo;
+  if (frameState.systemStatus.timeValid && getLocalTime(&timeinfo, 0) &&
+      timeinfo.tm_hour >= 0 && timeinfo.tm_hour < Layout::CHART_HOURS) {
+    chartHour = timeinfo.tm_hour;
+  } else {
+    chartHour = -1;
+  }
+}
+
+int chartCurrentHour() {
+  return chartHour;
+}
@@ -0,0 +1,67 @@
+#ifndef CHART_MODEL_H
+#define CHART_MODEL_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              24H-PREISCHART: GEMEINSAMES MODELL
+// ═══════════════════════════════════════════════════════════════════════════════
+// Die drei Preis-Charts (Legacy-Chart, Analytics-Chart, Ökostrom-Screen) lesen
+// Skalierung und Farbklassen aus einem Modell, das nur bei neuen Day-Ahead-
+// Daten (lastUpdate/lastAnalysis) neu berechnet wird. Pro Frame ändert sich
+// nur die aktuelle Stunde für die Hervorhebung.
+
+enum PriceChartView : uint8_t {
+  CHART_VIEW_LEGACY = 0,   // drawPriceChart: Farbe relativ zur Spannenmitte
+  CHART_VIEW_ANALYTICS,    // drawSimplePriceChart: Farbe nach PriceCategory
+  CHART_VIEW_OEKOSTROM,    // Ökostrom-Screen: Farbe nach Quartil der Spanne
+  CHART_VIEW_COUNT
+};
+
+struct PriceChartModel {
+  // Schlüssel der Daten, aus denen das Modell berechnet wurde
+  bool built = false;
+  bool hasData = false;
+  unsigned long dataUpdate = 0;
+  unsigned long dataAnalysis = 0;
+
+  // Skalierung über alle gültigen Stunden
+  int validCount = 0;
+  float minPrice = 0.0f;
+  float maxPrice = 0.0f;
+  float avgPrice = 0.0f;
+
+  // Analytics-Skalierung (dayAheadPrices.minPrice/maxPrice)
+  bool analyticsRangeValid = false;
+
+  // Pro Stunde: relative Höhe 0..1 und Farbe je Ansicht
+  bool valid[Layout::CHART_HOURS] = {};
+  float level[Layout::CHART_HOURS] = {};           // bezogen auf minPrice..maxPrice
+  float analyticsLevel[Layout::CHART_HOURS] = {};  // bezogen auf Analytics-Spanne
+  uint16_t color[CHART_VIEW_COUNT][Layout::CHART_HOURS] = {};
+
+  unsigned long rebuilds = 0;
+
+  // Balkenhöhe in Pixeln für eine nutzbare Chart-Höhe
+  int barHeight(int hour, int usableHeight) const {
+    return (int)(level[hour] * usableHeight);
+  }
+  int analyticsBarHeight(int hour, int usableHeight) const {
+    return (int)(analyticsLevel[hour] * usableHeight);
+  }
+  // Y-Position der Durchschnittslinie relativ zur Chart-Unterkante
+  int averageOffset(int usableHeight) const {
+    float range = maxPrice - minPrice;
+    return range > 0.0f ? (int)((avgPrice - minPrice) / range * usableHeight) : 0;
+  }
+};
+
+// Liefert das Modell, baut es bei geänderten Daten neu auf
+const PriceChartModel& priceChartModel();
+
+// Aktuelle Stunde einmal pro Frame bestimmen (-1 = Zeit nicht gültig)
+void updateChartClock();
+int chartCurrentHour();
+
+#endif // CHART_MODEL_H
@@ -65,8 +65,6 @@ namespace Layout {
   // UI-Element Größen
   constexpr int INDICATOR_RADIUS = 5;
   constexpr int PROGRESS_BAR_HEIGHT = 4;
-  constexpr int SYSTEM_INFO_WIDTH = 80;
-  constexpr int SYSTEM_INFO_HEIGHT = 60;  // Erweitert für Uhrzeit
   
   // Abstände und Offsets
   constexpr int PADDING_SMALL = 3;
@@ -79,20 +77,6 @@ namespace Layout {
   constexpr int STATUS_BAR_WIDTH = 200;
   constexpr int STATUS_BAR_HEIGHT = 20;
 
-  constexpr int SYSTEM_INFO_X = 240;
-  constexpr int SYSTEM_INFO_Y = 200;
-  constexpr int SYSTEM_INFO_EXTENDED_HEIGHT = 20;
-
-  constexpr int NETWORK_INFO_X = 10;
-  constexpr int NETWORK_INFO_Y = 200;
-  constexpr int NETWORK_INFO_WIDTH = 120;
-  constexpr int NETWORK_INFO_LINES = 3;
-
-  constexpr int TIME_DISPLAY_X = 240;
-  constexpr int TIME_DISPLAY_Y = 8;
-  constexpr int TIME_DISPLAY_WIDTH = 80;
-  constexpr int TIME_DISPLAY_HEIGHT = 32;
-
   // Touch und Chart Konstanten
   constexpr int MAX_TOUCH_MARKERS = 5;
   constexpr int CHART_HOURS = 24;
@@ -117,8 +101,13 @@ namespace Timing {
   constexpr unsigned long ANTI_BURNIN_INTERVAL = 900000; // 15 Minuten
   constexpr unsigned long SYSTEM_UPDATE_INTERVAL = 2000;
   constexpr unsigned long TIMEOUT_CHECK_INTERVAL = 10000;
-  constexpr unsigned long RENDER_UPDATE_INTERVAL = 500;
   constexpr unsigned long TIME_UPDATE_INTERVAL = 60000;  // Uhrzeit alle Minute aktualisieren
+
+  // Frame-Deadlines: spätestens so lange nach einer Änderung ist sie auf dem
+  // Panel. Änderungen innerhalb der Frist werden in einem Frame gesammelt.
+  constexpr unsigned long FRAME_DEADLINE_TOUCH = 30;        // Touch-Feedback, Navigation
+  constexpr unsigned long FRAME_DEADLINE_TELEMETRY = 1000;  // Sensorwerte, Preise, Status
+  constexpr unsigned long FRAME_DEADLINE_NIGHT = 30000;     // Telemetrie im Nachtmodus
   
   // Network Timeouts
   constexpr int WIFI_CONNECT_TIMEOUT_S = 30;
@@ -205,6 +194,9 @@ namespace NetworkConfig {
   constexpr const char* const HISTORY_REQUEST = "display/history_request";
   constexpr const char* const HISTORY_RESPONSE = "display/history_response";
   constexpr const char* const ENERGY_MARKET_PRICE_DAY_AHEAD = "home/energy/price_forecast_24h";
+  constexpr const char* const RENDER_PROFILE = "display/render_profile";  // + "/<abschnitt>"
+  constexpr const char* const SCREENSHOT_REQUEST = "display/screenshot/request";  // "full", "stream", "stop"
+  constexpr const char* const SCREENSHOT = "display/screenshot";                  // binär, siehe screenshot.h
 
   // Power Management Topics (alle Werte in kW als Float)
   constexpr const char* const PV_POWER = "home/PV/PVCurrentPower";          // Aktuelle PV-Erzeugungsleistung (immer positiv)
@@ -329,8 +321,20 @@ struct SystemStatus {
   // Performance-Counter
   struct Performance {
     unsigned long totalRedraws = 0;
-    unsigned long skippedRedraws = 0;
-    float redrawEfficiency = 100.0f;   // Prozent eingesparte Redraws
+    uint64_t pixelsPushed = 0;         // Per SPI übertragene Pixel (Summe der geflushten Rechtecke)
+    uint64_t pixelsSaved = 0;          // Gegenüber einem Vollbild-Redraw pro Frame eingesparte Pixel
+    uint64_t tilesPushed = 0;          // Kacheln aus Sprites/Bändern mit geändertem Inhalt übertragen
+    uint64_t tilesSkipped = 0;         // Kacheln mit unverändertem Inhalt nicht übertragen
+    
+    float pixelSavingsPercent() const {
+      uint64_t total = pixelsPushed + pixelsSaved;
+      return total > 0 ? (float)((double)pixelsSaved * 100.0 / (double)total) : 0.0f;
+    }
+
+    float tileSkipPercent() const {
+      uint64_t total = tilesPushed + tilesSkipped;
+      return total > 0 ? (float)((double)tilesSkipped * 100.0 / (double)total) : 0.0f;
+    }
   } performance;
   
   void updateCpuUsage(float newSample) {
@@ -470,49 +474,346 @@ struct AntiBurninManager {
   }
 };
 
+// Rechteck in Bildschirmkoordinaten für Dirty-Region-Tracking
+struct DirtyRect {
+  int16_t x = 0, y = 0, w = 0, h = 0;
+
+  DirtyRect() {}
+  DirtyRect(int x, int y, int w, int h) : x(x), y(y), w(w), h(h) {}
+
+  bool isEmpty() const { return w <= 0 || h <= 0; }
+  long area() const { return isEmpty() ? 0 : (long)w * h; }
+  int right() const { return x + w; }
+  int bottom() const { return y + h; }
+
+  bool intersects(const DirtyRect& o) const {
+    return !isEmpty() && !o.isEmpty() &&
+           x < o.right() && o.x < right() && y < o.bottom() && o.y < bottom();
+  }
+
+  bool contains(const DirtyRect& o) const {
+    return !isEmpty() && o.x >= x && o.y >= y && o.right() <= right() && o.bottom() <= bottom();
+  }
+
+  long intersectionArea(const DirtyRect& o) const {
+    if (!intersects(o)) return 0;
+    int ix = max((int)x, (int)o.x), iy = max((int)y, (int)o.y);
+    return (long)(min(right(), o.right()) - ix) * (min(bottom(), o.bottom()) - iy);
+  }
+
+  DirtyRect intersectionWith(const DirtyRect& o) const {
+    if (!intersects(o)) return DirtyRect();
+    int ix = max((int)x, (int)o.x), iy = max((int)y, (int)o.y);
+    return DirtyRect(ix, iy, min(right(), o.right()) - ix, min(bottom(), o.bottom()) - iy);
+  }
+
+  DirtyRect unionWith(const DirtyRect& o) const {
+    if (isEmpty()) return o;
+    if (o.isEmpty()) return *this;
+    int ux = min((int)x, (int)o.x), uy = min((int)y, (int)o.y);
+    return DirtyRect(ux, uy, max(right(), o.right()) - ux, max(bottom(), o.bottom()) - uy);
+  }
+
+  // Auf die Displayfläche beschneiden
+  DirtyRect clipped() const {
+    int cx = max((int)x, 0), cy = max((int)y, 0);
+    int cr = min(right(), Layout::DISPLAY_WIDTH), cb = min(bottom(), Layout::DISPLAY_HEIGHT);
+    return DirtyRect(cx, cy, cr - cx, cb - cy);
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              WIDGET-LAYOUT
+// ═══════════════════════════════════════════════════════════════════════════════
+// Einzige Quelle für Lage und Größe der festen UI-Elemente. Zeichnen, Dirty-
+// Rechtecke, Sensor-Layouts und Touch-Hit-Tests lesen dieselben Einträge.
+// Alle Widgets folgen dem Anti-Burnin-Offset in X; shiftY sagt, ob auch in Y.
+// Beim Kompilieren geprüft: alle Widgets liegen im Panel, und kein Paar eines
+// Screens überlappt - bei unterschiedlicher Y-Verschiebung auch nicht mit
+// maximalem Offset.
+
+enum WidgetId : uint8_t {
+  // Home-Screen in Zeichenreihenfolge (spätere übermalen frühere)
+  WIDGET_SENSOR_FIRST = 0,   // Sensor-Boxen, Index = sensors[]
+  WIDGET_SETTINGS = System::SENSOR_COUNT,
+  WIDGET_SYSTEM_INFO,
+  WIDGET_NETWORK_STATUS,
+  WIDGET_TIME,
+  WIDGET_DEBUG_HUD,          // nur eingeblendet sichtbar (debug_hud.h)
+  HOME_WIDGET_COUNT,
+
+  // Detail-Screens
+  WIDGET_BACK_BUTTON = HOME_WIDGET_COUNT,
+  WIDGET_CALIBRATION_START,
+  WIDGET_CALIBRATION_STOP,
+  WIDGET_COUNT
+};
+
+struct WidgetLayout {
+  int16_t x, y, w, h;        // ohne Anti-Burnin-Offset
+  bool shiftY;
+
+  constexpr int right() const { return x + w; }
+  constexpr int bottom() const { return y + h; }
+
+  // Lage bei gegebenem Anti-Burnin-Offset
+  DirtyRect at(int offsetX, int offsetY) const {
+    return DirtyRect(x + offsetX, y + (shiftY ? offsetY : 0), w, h);
+  }
+
+  // Hit-Test mit optionalem Rand um das Widget
+  bool contains(int px, int py, int offsetX, int offsetY, int margin = 0) const {
+    int left = x + offsetX - margin, top = y + (shiftY ? offsetY : 0) - margin;
+    return px >= left && px < left + w + 2 * margin && py >= top && py < top + h + 2 * margin;
+  }
+};
+
+constexpr WidgetLayout WIDGETS[WIDGET_COUNT] = {
+  // 3x3-Raster der Sensor-Boxen ohne untere rechte Ecke
+  { 10,  35, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [0] Oekostrom
+  {115,  35, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [1] Preis
+  {220,  35, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [2] Aktie
+  { 10,  85, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [3] Ladestand
+  {115,  85, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [4] Verbrauch
+  {220,  85, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [5] PV-Erzeugung
+  { 10, 135, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [6] Aussen
+  {115, 135, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true},   // [7] Wasser
+  {220, 135, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, false},  // Settings (freie Ecke)
+  {240, 200,  80, 3 * Layout::LINE_SPACING + 4, false},                    // System-Info (3 Zeilen)
+  { 10, 200, 120, 3 * Layout::LINE_SPACING, false},                        // Netzwerk/MQTT/OTA
+  {240,   7,  80, 26, false},                                              // Uhrzeit + Datum
+  { 10, 181, 300, 12, false},                                              // Debug-HUD (eine Zeile Font 1)
+  {270,  10,  40, 20, true},                                               // Zurück-Button
+  { 10,  90, 150, 30, false},                                              // Kalibrierung starten
+  {170,  90, 100, 30, false},                                              // Kalibrierung beenden
+};
+
+namespace WidgetLayoutCheck {
+  constexpr bool insidePanel(int i) {
+    return i >= WIDGET_COUNT ||
+           (WIDGETS[i].x >= 0 && WIDGETS[i].y >= 0 && WIDGETS[i].w > 0 && WIDGETS[i].h > 0 &&
+            WIDGETS[i].right() <= Layout::DISPLAY_WIDTH && WIDGETS[i].bottom() <= Layout::DISPLAY_HEIGHT &&
+            insidePanel(i + 1));
+  }
+
+  // Alle Widgets verschieben sich gemeinsam in X; in Y braucht ein Paar mit
+  // unterschiedlichem shiftY den maximalen Offset als Abstand
+  constexpr bool separated(const WidgetLayout& a, const WidgetLayout& b) {
+    return a.right() <= b.x || b.right() <= a.x ||
+           a.bottom() + (a.shiftY != b.shiftY ? System::ANTI_BURNIN_STEPS : 0) <= b.y ||
+           b.bottom() + (a.shiftY != b.shiftY ? System::ANTI_BURNIN_STEPS : 0) <= a.y;
+  }
+
+  constexpr bool separatedFrom(int i, int j, int last) {
+    return j >= last || (separated(WIDGETS[i], WIDGETS[j]) && separatedFrom(i, j + 1, last));
+  }
+
+  // Kein Paar im Bereich [first, last) überlappt
+  constexpr bool disjoint(int first, int last) {
+    return first >= last || (separatedFrom(first, first + 1, last) && disjoint(first + 1, last));
+  }
+}
+
+static_assert(WidgetLayoutCheck::insidePanel(0), "Widget liegt außerhalb des Panels");
+static_assert(WidgetLayoutCheck::disjoint(0, HOME_WIDGET_COUNT), "Home-Widgets überlappen");
+static_assert(WidgetLayoutCheck::disjoint(HOME_WIDGET_COUNT, WIDGET_COUNT), "Detail-Widgets überlappen");
+
 // Render-Manager für effiziente Updates
 struct RenderManager {
+  static constexpr int MAX_DIRTY_RECTS = 12;
+  static constexpr long MERGE_SLACK_PIXELS = 256;  // Tolerierter Mehraufwand beim Zusammenfassen
+  
+
   bool fullRedrawRequired = true;
-  unsigned long lastRenderUpdate = 0;
+  
+  // Nächster Frame: fällig zur frühesten Deadline der seither markierten
+  // Änderungen. Ohne Änderung ist kein Frame geplant.
+  bool frameScheduled = false;
+  unsigned long frameDeadline = 0;    // millis()
   bool systemInfoChanged = false;
   bool networkStatusChanged = false;
   bool timeChanged = false;
   
   struct ChangeFlags {
     bool sensors[System::SENSOR_COUNT] = {false};
+    bool sensorTouched[System::SENSOR_COUNT] = {false};   // Touch-Feedback (Vorrang im Frame-Budget)
     bool systemInfo = false;
     bool networkStatus = false;
     bool time = false;
+    bool debugHud = false;
     bool fullScreen = false;
     bool antiBurnin = false;
+    bool panelOverwritten = false;   // Panel zeigt nicht mehr den letzten Frame
   } changes;
   
-  void markSensorChanged(int index) {
+  // Plant den Frame spätestens 'deadlineMs' ab jetzt (frühere Deadline gewinnt)
+  void scheduleFrame(unsigned long deadlineMs) {
+    unsigned long deadline = millis() + deadlineMs;
+    if (!frameScheduled || (long)(deadline - frameDeadline) < 0) {
+      frameDeadline = deadline;
+    }
+    frameScheduled = true;
+  }
+  
+  // Frist für Telemetrie (Sensoren, System- und Netzwerkzeile, Uhrzeit,
+  // Debug-HUD, Anti-Burnin). Der Nachtmodus (backlight.cpp) streckt sie;
+  // Touch und Navigation behalten FRAME_DEADLINE_TOUCH.
+  unsigned long telemetryDeadlineMs = Timing::FRAME_DEADLINE_TELEMETRY;
+  
+  void markSensorChanged(int index) { markSensorChanged(index, telemetryDeadlineMs); }
+  void markSensorChanged(int index, unsigned long deadlineMs) {
     if (index >= 0 && index < System::SENSOR_COUNT) {
       changes.sensors[index] = true;
+      scheduleFrame(deadlineMs);
     }
   }
   
-  void markSystemInfoChanged() { changes.systemInfo = true; }
-  void markNetworkStatusChanged() { changes.networkStatus = true; }
-  void markTimeChanged() { changes.time = true; }
-  void markFullRedrawRequired() { changes.fullScreen = true; }
-  void markAntiBurninChanged() { changes.antiBurnin = true; }
+  void markSensorTouched(int index) {
+    if (index >= 0 && index < System::SENSOR_COUNT) {
+      changes.sensorTouched[index] = true;
+      markSensorChanged(index, Timing::FRAME_DEADLINE_TOUCH);
+    }
+  }
+  
+  void markSystemInfoChanged() { changes.systemInfo = true; scheduleFrame(telemetryDeadlineMs); }
+  void markNetworkStatusChanged() { changes.networkStatus = true; scheduleFrame(telemetryDeadlineMs); }
+  void markTimeChanged() { changes.time = true; scheduleFrame(telemetryDeadlineMs); }
+  void markDebugHudChanged() { markDebugHudChanged(telemetryDeadlineMs); }
+  void markDebugHudChanged(unsigned long deadlineMs) {
+    changes.debugHud = true;
+    scheduleFrame(deadlineMs);
+  }
+  // Standard: Navigation per Touch
+  void markFullRedrawRequired(unsigned long deadlineMs = Timing::FRAME_DEADLINE_TOUCH) {
+    changes.fullScreen = true;
+    scheduleFrame(deadlineMs);
+  }
+  // Nach direktem Zeichnen außerhalb von updateDisplay() (OTA, Kalibrierung,
+  // Touch-Marker): Vollbild ohne Vergleich mit dem vorherigen Frame
+  void markPanelOverwritten() {
+    changes.fullScreen = true;
+    changes.panelOverwritten = true;
+    scheduleFrame(Timing::FRAME_DEADLINE_TOUCH);
+  }
+  void markAntiBurninChanged() { changes.antiBurnin = true; scheduleFrame(telemetryDeadlineMs); }
+  
+  // Dirty-Rechtecke (Bildschirmkoordinaten, bereits zusammengefasst)
+  DirtyRect dirtyRects[MAX_DIRTY_RECTS];
+  int dirtyRectCount = 0;
+  
+  // Fügt ein Rechteck hinzu und fasst es mit überlappenden oder nahe
+  // benachbarten Rechtecken zusammen, solange dabei kaum Fläche hinzukommt
+  void markDirty(const DirtyRect& rect) {
+    DirtyRect pending = rect.clipped();
+    if (pending.isEmpty()) return;
+    
+    bool merged = true;
+    while (merged) {
+      merged = false;
+      for (int i = 0; i < dirtyRectCount; i++) {
+        const DirtyRect& existing = dirtyRects[i];
+        if (existing.contains(pending)) return;
+        
+        DirtyRect combined = existing.unionWith(pending);
+        long covered = existing.area() + pending.area() - existing.intersectionArea(pending);
+        if (combined.area() - covered <= MERGE_SLACK_PIXELS) {
+          pending = combined;
+          dirtyRects[i] = dirtyRects[--dirtyRectCount];
+          merged = true;
+          break;
+        }
+      }
+    }
+    
+    if (dirtyRectCount == MAX_DIRTY_RECTS) {
+      // Liste voll: mit dem Rechteck mit dem geringsten Flächenzuwachs vereinen
+      int best = 0;
+      long bestGrowth = -1;
+      for (int i = 0; i < dirtyRectCount; i++) {
+        long growth = dirtyRects[i].unionWith(pending).area() - dirtyRects[i].area();
+        if (bestGrowth < 0 || growth < bestGrowth) {
+          bestGrowth = growth;
+          best = i;
+        }
+      }
+      DirtyRect combined = dirtyRects[best].unionWith(pending);
+      dirtyRects[best] = dirtyRects[--dirtyRectCount];
+      markDirty(combined);
+      return;
+    }
+    
+    dirtyRects[dirtyRectCount++] = pending;
+  }
+  
+  long dirtyPixelCount() const {
+    long total = 0;
+    for (int i = 0; i < dirtyRectCount; i++) total += dirtyRects[i].area();
+    return total;
+  }
   
   void clearAllFlags() {
     memset(&changes, false, sizeof(changes));
+    dirtyRectCount = 0;
     fullRedrawRequired = false;
+    frameScheduled = false;           // alles Markierte ist gezeichnet
   }
   
-  bool needsUpdate() const {
-    unsigned long now = millis();
-    return (now - lastRenderUpdate >= Timing::RENDER_UPDATE_INTERVAL) &&
-           (fullRedrawRequired || hasAnyChanges());
+  // Millisekunden bis der geplante Frame gestartet werden muss, damit er bei
+  // 'frameCostMs' Zeichenzeit zur Deadline fertig ist. -1: kein Frame geplant.
+  long msUntilFrame(unsigned long now, unsigned long frameCostMs) const {
+    if (!frameScheduled) return -1;
+    long remaining = (long)(frameDeadline - now) - (long)frameCostMs;
+    return remaining > 0 ? remaining : 0;
+  }
+  
+  bool needsUpdate(unsigned long frameCostMs = 0) const {
+    return msUntilFrame(millis(), frameCostMs) == 0;
+  }
+  
+  // Frame an Render-Task/updateDisplay() übergeben. Was danach markiert wird,
+  // plant einen neuen Frame (oder wird noch vom übergebenen mitgezeichnet).
+  void frameDispatched() { frameScheduled = false; }
+  
+  // Frame-Beginn (unter DisplayLock): Change-Flags und Dirty-Rechtecke gehen
+  // an die Kopie des Renderers und werden hier zurückgesetzt. Die Planung
+  // bleibt - was seit frameDispatched() markiert wurde, ist weiter geplant.
+  void handOverChanges(RenderManager& frame) {
+    frame = *this;
+    frame.frameScheduled = false;
+    changes = ChangeFlags();
+    dirtyRectCount = 0;
+    fullRedrawRequired = false;
+  }
+  
+  // Frame-Ende (unter DisplayLock): was der Renderer nicht gezeichnet oder
+  // für einen Folge-Frame markiert hat, kommt samt Deadline zurück
+  void takeBackChanges(const RenderManager& frame) {
+    const ChangeFlags& rest = frame.changes;
+    for (int i = 0; i < System::SENSOR_COUNT; i++) {
+      changes.sensors[i] = changes.sensors[i] || rest.sensors[i];
+      changes.sensorTouched[i] = changes.sensorTouched[i] || rest.sensorTouched[i];
+    }
+    changes.systemInfo = changes.systemInfo || rest.systemInfo;
+    changes.networkStatus = changes.networkStatus || rest.networkStatus;
+    changes.time = changes.time || rest.time;
+    changes.debugHud = changes.debugHud || rest.debugHud;
+    changes.fullScreen = changes.fullScreen || rest.fullScreen;
+    changes.antiBurnin = changes.antiBurnin || rest.antiBurnin;
+    changes.panelOverwritten = changes.panelOverwritten || rest.panelOverwritten;
+    fullRedrawRequired = fullRedrawRequired || frame.fullRedrawRequired;
+    for (int i = 0; i < frame.dirtyRectCount; i++) markDirty(frame.dirtyRects[i]);
+    if (frame.frameScheduled &&
+        (!frameScheduled || (long)(frame.frameDeadline - frameDeadline) < 0)) {
+      frameDeadline = frame.frameDeadline;
+    }
+    frameScheduled = frameScheduled || frame.frameScheduled;
   }
   
   bool hasAnyChanges() const {
+    if (dirtyRectCount > 0) return true;
+    
     if (changes.fullScreen || changes.systemInfo || 
-        changes.networkStatus || changes.time || changes.antiBurnin) {
+        changes.networkStatus || changes.time || changes.debugHud || changes.antiBurnin) {
       return true;
     }
     
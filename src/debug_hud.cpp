@@ -0,0 +1,110 @@
+#include "debug_hud.h"
+
+extern SystemStatus systemStatus;
+extern DisplayMode currentMode;
+
+DebugHudStats debugHudStats;
+
+static bool visible = false;
+static char text[DebugHudConfig::TEXT_LENGTH] = "";
+
+// Laufendes Messfenster
+static unsigned long windowStart = 0;
+static unsigned long windowFrames = 0;
+static unsigned long windowMaxFrameMicros = 0;
+static unsigned long lastFrameMicros = 0;
+static unsigned long windowLoops = 0;
+static unsigned long windowLoopMicros = 0;
+static unsigned long windowMaxLoopMicros = 0;
+static unsigned long windowMqttMessages = 0;
+
+static void resetWindow(unsigned long now) {
+  windowStart = now;
+  windowFrames = 0;
+  windowMaxFrameMicros = 0;
+  windowLoops = 0;
+  windowLoopMicros = 0;
+  windowMaxLoopMicros = 0;
+  windowMqttMessages = 0;
+}
+
+// Millisekunden mit einer Nachkommastelle, auf die Feldbreite begrenzt
+static float toMs(unsigned long micros) {
+  return min(micros, 999900UL) / 1000.0f;
+}
+
+static void formatText(unsigned long elapsedMs) {
+  elapsedMs = max(elapsedMs, 1UL);
+  unsigned long fps = windowFrames * 1000 / elapsedMs;
+  unsigned long mqttPerSecond = windowMqttMessages * 1000 / elapsedMs;
+  unsigned long averageLoop = windowLoops > 0 ? windowLoopMicros / windowLoops : 0;
+
+  snprintf(text, sizeof(text), "%2lufps F:%.1f/%.1fms L:%.1f/%.1fms MQ:%2lu/s %3luK",
+           min(fps, 99UL), toMs(lastFrameMicros), toMs(windowMaxFrameMicros),
+           toMs(averageLoop), toMs(windowMaxLoopMicros), min(mqttPerSecond, 99UL),
+           min((unsigned long)systemStatus.freeHeap / 1024, 999UL));
+}
+
+void toggleDebugHud() {
+  if (!DebugHudConfig::ENABLED) return;
+
+  visible = !visible;
+  debugHudStats.toggles++;
+  unsigned long now = millis();
+  if (visible) {
+    // Erste Zeile sofort, mit den Werten seit dem letzten Fenster
+    formatText(now - windowStart);
+    resetWindow(now);
+  }
+  renderManager.markDebugHudChanged(Timing::FRAME_DEADLINE_TOUCH);
+  Serial.printf("Debug-HUD %s\n", visible ? "eingeblendet" : "ausgeblendet");
+}
+
+bool isDebugHudVisible() {
+  return visible;
+}
+
+void noteHudFrame(unsigned long frameMicros) {
+  windowFrames++;
+  lastFrameMicros = frameMicros;
+  windowMaxFrameMicros = max(windowMaxFrameMicros, frameMicros);
+  debugHudStats.maxFrameMicros = max(debugHudStats.maxFrameMicros, frameMicros);
+}
+
+void noteHudLoop(unsigned long loopMicros) {
+  windowLoops++;
+  windowLoopMicros += loopMicros;
+  windowMaxLoopMicros = max(windowMaxLoopMicros, loopMicros);
+  debugHudStats.maxLoopMicros = max(debugHudStats.maxLoopMicros, loopMicros);
+}
+
+void noteHudMqttMessage() {
+  windowMqttMessages++;
+}
+
+void updateDebugHud(unsigned long now) {
+  if (now - windowStart < DebugHudConfig::REFRESH_MS) return;
+
+  if (visible) {
+    char previous[DebugHudConfig::TEXT_LENGTH];
+    strcpy(previous, text);
+    formatText(now - windowStart);
+    // Gleicher Text: kein Frame (auch nicht für das HUD selbst)
+    if (currentMode == HOME_SCREEN && strcmp(previous, text) != 0) {
+      renderManager.markDebugHudChanged();
+      debugHudStats.refreshes++;
+    }
+  }
+  resetWindow(now);
+}
+
+unsigned long msUntilDebugHudRefresh(unsigned long now, unsigned long limit) {
+  if (!visible) return limit;
+  long remaining = (long)(windowStart + DebugHudConfig::REFRESH_MS - now);
+  if (remaining <= 0) return 0;
+  return min((unsigned long)remaining, limit);
+}
+
+const char* debugHudText() {
+  return text;
+}
@@ -0,0 +1,55 @@
+#ifndef DEBUG_HUD_H
+#define DEBUG_HUD_H
+
+#include <Arduino.h>
+#include "config.h"
+
+extern RenderManager renderManager;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              DEBUG-HUD
+// ═══════════════════════════════════════════════════════════════════════════════
+// Einblendbare Messzeile für die Fehlersuche am Gerät: Long-Press auf die
+// freie Ecke (Settings) schaltet sie ein und aus. Sie belegt den reservierten
+// Streifen WIDGET_DEBUG_HUD zwischen Sensor-Raster und Statuszeilen und wird
+// wie jedes Home-Widget über Dirty-Rechteck und Frame-Budget gezeichnet
+// (Vorrang "Dekoration"). Der Text wird nur einmal je REFRESH_MS neu gesetzt,
+// damit die Anzeige selbst kaum Frames erzeugt:
+//   <fps> F:<letzter>/<max Frame ms> L:<Ø>/<max loop()-Durchlauf ms> MQ:<Nachrichten/s> <Heap K>
+// Ausgeblendet kostet sie nichts: der Streifen gehört dann zum Hintergrund.
+
+namespace DebugHudConfig {
+  constexpr bool ENABLED = true;                 // false: Long-Press in der Ecke ohne Wirkung
+  constexpr unsigned long REFRESH_MS = 1000;     // Messfenster und Anzeigetakt
+  constexpr int TEXT_LENGTH = 56;
+}
+
+// Long-Press auf die freie Ecke
+void toggleDebugHud();
+bool isDebugHudVisible();
+
+// Messpunkte (billig, auch bei ausgeblendetem HUD)
+void noteHudFrame(unsigned long frameMicros);   // updateDisplay()
+void noteHudLoop(unsigned long loopMicros);     // ein Durchlauf von loop()
+void noteHudMqttMessage();                      // onMqttMessage()
+
+// Aus loop(): Messfenster abschließen und Text neu setzen, wenn fällig
+void updateDebugHud(unsigned long now);
+
+// Zeit bis zur nächsten Auffrischung, höchstens 'limit' (ausgeblendet: limit)
+unsigned long msUntilDebugHudRefresh(unsigned long now, unsigned long limit);
+
+// Angezeigte Zeile (gültig bis zum nächsten updateDebugHud())
+const char* debugHudText();
+
+// Statistik
+struct DebugHudStats {
+  unsigned long toggles = 0;
+  unsigned long refreshes = 0;          // neu gesetzte Texte
+  unsigned long maxFrameMicros = 0;     // seit dem Start (das HUD-Fenster vergisst)
+  unsigned long maxLoopMicros = 0;
+};
+
+extern DebugHudStats debugHudStats;
+
+#endif // DEBUG_HUD_H
@@ -1,5 +1,13 @@
 #include "display.h"
+#include "render.h"
 #include "ota.h"
+#include "chart_model.h"
+#include "display_list.h"
+#include "palette_buffer.h"
+#include "glyph_cache.h"
+#include "debug_hud.h"
+#include "screenshot.h"
+#include "frame_scheduler.h"
 #include <cmath>
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -19,136 +27,1040 @@ TouchMarker touchMarkers[Layout::MAX_TOUCH_MARKERS];
 int nextMarkerIndex = 0;
 
 // ═══════════════════════════════════════════════════════════════════════════════
-//                              HAUPT-RENDER-FUNKTIONEN
+//                              DIRTY-RECT FLUSH (HOME-SCREEN)
 // ═══════════════════════════════════════════════════════════════════════════════
 
-void clearOldElements() {
-  // Löscht Elemente an der alten Anti-Burnin Position
-  int oldOffsetX = antiBurnin.getLastOffsetX();
-  
-  // Titel-Bereich löschen
-  tft.fillRect(Layout::PADDING_LARGE + oldOffsetX, Layout::STATUS_BAR_Y, Layout::STATUS_BAR_WIDTH, Layout::STATUS_BAR_HEIGHT, Colors::BG_MAIN);
-  
-  // Alle Sensor-Boxen an alter Position löschen
-  for (int i = 0; i < System::SENSOR_COUNT; i++) {
-    const SensorData& sensor = sensors[i];
-    tft.fillRect(sensor.layout.x + oldOffsetX, sensor.layout.y, 
-                sensor.layout.w, sensor.layout.h, Colors::BG_MAIN);
+constexpr long FULL_FRAME_PIXELS = (long)Layout::DISPLAY_WIDTH * Layout::DISPLAY_HEIGHT;
+
+static void recordFullFrame() {
+  systemStatus.performance.pixelsPushed += FULL_FRAME_PIXELS;
+}
+
+static void recordPartialFrame(long pushed) {
+  systemStatus.performance.pixelsPushed += pushed;
+  systemStatus.performance.pixelsSaved += max(0L, FULL_FRAME_PIXELS - pushed);
+}
+
+// Bildschirmbereich eines Widgets bei gegebenem Anti-Burnin-Offset
+static DirtyRect homeWidgetRect(int widget, int offsetX, int offsetY) {
+  if (widget < 0 || widget >= HOME_WIDGET_COUNT) return DirtyRect();
+  return WIDGETS[widget].at(offsetX, offsetY);
+}
+
+// Deckende Widgets übermalen ihr gesamtes Rechteck selbst (Sprite bzw. fillRect)
+static bool homeWidgetIsOpaque(int widget) {
+  return widget != WIDGET_SETTINGS;
+}
+
+static void drawHomeWidget(int widget) {
+  if (widget < System::SENSOR_COUNT) {
+    drawSensorBox(widget);
+    frameState.sensors[widget].markRendered();
+    return;
+  }
+
+  finishPanelDMA();  // Übrige Widgets zeichnen direkt aufs Panel
+  switch (widget) {
+    case WIDGET_SETTINGS:       drawSettingsBox(); break;
+    case WIDGET_SYSTEM_INFO:    drawSystemInfo(); break;
+    case WIDGET_NETWORK_STATUS: drawNetworkStatus(); break;
+    case WIDGET_TIME:           drawTimeDisplay(); break;
+    case WIDGET_DEBUG_HUD:      drawDebugHud(); break;
   }
-  
-  // System-Info und andere UI-Elemente
-  tft.fillRect(Layout::SYSTEM_INFO_X + oldOffsetX, Layout::SYSTEM_INFO_Y, Layout::SYSTEM_INFO_WIDTH, Layout::SYSTEM_INFO_HEIGHT + Layout::SYSTEM_INFO_EXTENDED_HEIGHT, Colors::BG_MAIN);
-  tft.fillRect(Layout::NETWORK_INFO_X + oldOffsetX, Layout::NETWORK_INFO_Y, Layout::NETWORK_INFO_WIDTH, Layout::LINE_SPACING * Layout::NETWORK_INFO_LINES, Colors::BG_MAIN);
-  
-  // Zeit-Display
-  tft.fillRect(Layout::TIME_DISPLAY_X + oldOffsetX, Layout::TIME_DISPLAY_Y, Layout::TIME_DISPLAY_WIDTH, Layout::TIME_DISPLAY_HEIGHT, Colors::BG_MAIN);
-  
-  Serial.println("Alte UI-Elemente gelöscht");
 }
 
-void updateDisplay() {
-  switch (currentMode) {
-    case PRICE_DETAIL_SCREEN:
-      drawPriceDetailScreen();
-      renderManager.clearAllFlags();
-      return;
+// Widget durch Change-Flags oder eigenen Zustand (Timeout, Wert) veraltet
+static bool homeWidgetChanged(int widget) {
+  if (widget < System::SENSOR_COUNT) {
+    return frameState.renderManager.changes.sensors[widget] || frameState.sensors[widget].needsRedraw();
+  }
+  switch (widget) {
+    case WIDGET_SYSTEM_INFO:    return frameState.renderManager.changes.systemInfo;
+    case WIDGET_NETWORK_STATUS: return frameState.renderManager.changes.networkStatus;
+    case WIDGET_TIME:           return frameState.renderManager.changes.time;
+    case WIDGET_DEBUG_HUD:      return frameState.renderManager.changes.debugHud;
+    default:                    return false;
+  }
+}
 
-    case OEKOSTROM_DETAIL_SCREEN:
-      drawOekostromDetailScreen();
-      renderManager.clearAllFlags();
-      return;
+static RenderPriority homeWidgetPriority(int widget) {
+  if (widget < System::SENSOR_COUNT) {
+    return frameState.renderManager.changes.sensorTouched[widget] ? PRIORITY_TOUCH : PRIORITY_VALUES;
+  }
+  return widget == WIDGET_TIME ? PRIORITY_VALUES : PRIORITY_DECORATION;
+}
 
-    case WALLBOX_CONSUMPTION_SCREEN:
-      drawWallboxConsumptionScreen();
-      renderManager.clearAllFlags();
-      return;
+// Übersetzt die Change-Flags in Dirty-Rechtecke
+static void collectHomeDirtyRects() {
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
+
+  // Anti-Burnin: alte und neue Position jedes Widgets (werden zusammengefasst)
+  if (frameState.renderManager.changes.antiBurnin) {
+    int lastOffsetX = frameState.antiBurnin.getLastOffsetX();
+    int lastOffsetY = frameState.antiBurnin.getLastOffsetY();
+    for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+      frameState.renderManager.markDirty(homeWidgetRect(w, lastOffsetX, lastOffsetY));
+      frameState.renderManager.markDirty(homeWidgetRect(w, offsetX, offsetY));
+    }
+  }
 
-    case LADESTAND_SCREEN:
-      drawLadestandScreen();
-      renderManager.clearAllFlags();
-      return;
+  for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+    if (homeWidgetChanged(w)) {
+      frameState.renderManager.markDirty(homeWidgetRect(w, offsetX, offsetY));
+    }
+  }
+}
 
-    case DAYAHEAD_SCREEN:
-      drawPriceDetailScreen();
-      renderManager.clearAllFlags();
-      return;
+// Löscht den Teil von 'rect', den keine deckenden Widgets übermalen - in
+// Zeilenbändern zwischen den Widget-Kanten. Zusammengefasste Rechtecke über
+// mehreren Boxen löschen so nur die Lücken, nicht die Boxen selbst.
+static void clearUncoveredArea(const DirtyRect& rect, int offsetX, int offsetY) {
+  DirtyRect covers[HOME_WIDGET_COUNT];
+  int coverCount = 0;
+  int edges[2 * HOME_WIDGET_COUNT + 2];
+  int edgeCount = 0;
+  edges[edgeCount++] = rect.y;
+  edges[edgeCount++] = rect.bottom();
+
+  for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+    if (!homeWidgetIsOpaque(w)) continue;
+    DirtyRect cover = homeWidgetRect(w, offsetX, offsetY).intersectionWith(rect);
+    if (cover.isEmpty()) continue;
+    if (cover.contains(rect)) return;   // ein Widget übermalt alles
+    // nach x sortiert einfügen
+    int i = coverCount++;
+    for (; i > 0 && covers[i - 1].x > cover.x; i--) covers[i] = covers[i - 1];
+    covers[i] = cover;
+    edges[edgeCount++] = cover.y;
+    edges[edgeCount++] = cover.bottom();
+  }
+
+  for (int i = 1; i < edgeCount; i++) {
+    for (int j = i; j > 0 && edges[j - 1] > edges[j]; j--) {
+      int swap = edges[j]; edges[j] = edges[j - 1]; edges[j - 1] = swap;
+    }
+  }
 
-    case SETTINGS_SCREEN:
-      drawSettingsScreen();
-      renderManager.clearAllFlags();
-      return;
+  finishPanelDMA();
+  for (int e = 0; e + 1 < edgeCount; e++) {
+    int y0 = edges[e], y1 = edges[e + 1];
+    if (y1 <= y0) continue;
+
+    // Lücken zwischen den Widgets, die das ganze Band überdecken
+    int x = rect.x;
+    for (int c = 0; c < coverCount; c++) {
+      const DirtyRect& cover = covers[c];
+      if (cover.y > y0 || cover.bottom() < y1) continue;
+      if (cover.x > x) tft.fillRect(x, y0, cover.x - x, y1 - y0, Colors::BG_MAIN);
+      x = max(x, cover.right());
+    }
+    if (x < rect.right()) tft.fillRect(x, y0, rect.right() - x, y1 - y0, Colors::BG_MAIN);
+  }
+}
+
+// Im Budget nicht mehr gezeichnete Widgets (für den Folge-Frame)
+static bool deferredHomeWidgets[HOME_WIDGET_COUNT];
+
+// Zeichnet nur die zusammengefassten Dirty-Rechtecke neu. Der Viewport
+// beschneidet alle Zeichenbefehle (auch pushSprite) auf das jeweilige
+// Rechteck, damit nur dessen Pixel über SPI gehen. Mit 'limited' werden
+// Rechtecke nach 'budgetEnd' (micros()) nicht mehr gezeichnet, sondern ihre
+// Widgets verschoben. Rückgabe: übertragene Pixel.
+static long flushDirtyRectList(bool limited, unsigned long budgetEnd) {
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
+  long pushed = 0;
+
+  for (int r = 0; r < frameState.renderManager.dirtyRectCount; r++) {
+    const DirtyRect& rect = frameState.renderManager.dirtyRects[r];
+
+    if (limited && (long)(micros() - budgetEnd) >= 0) {
+      for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+        if (homeWidgetRect(w, offsetX, offsetY).intersects(rect)) deferredHomeWidgets[w] = true;
+      }
+      continue;
+    }
 
-    case HOME_SCREEN:
-      break;
+    tft.setViewport(rect.x, rect.y, rect.w, rect.h, false);
+    clearUncoveredArea(rect, offsetX, offsetY);
 
-    default:
-      return;
+    for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+      if (homeWidgetRect(w, offsetX, offsetY).intersects(rect)) {
+        drawHomeWidget(w);
+        systemStatus.performance.totalRedraws++;
+      }
+    }
+
+    tft.resetViewport();
+    pushed += rect.area();
   }
-  
-  
-  // Anti-Burnin Change erfordert kompletten Redraw
-  if (renderManager.changes.antiBurnin) {
-    clearOldElements();
-    renderManager.markFullRedrawRequired();
-    Serial.println("Anti-Burnin Redraw ausgelöst");
+  return pushed;
+}
+
+static void flushDirtyRects() {
+  recordPartialFrame(flushDirtyRectList(false, 0));
+}
+
+// Selektiver Frame im Zeitbudget: je Vorrang-Klasse die geänderten Widgets
+// sammeln und zeichnen. Klassen werden nicht miteinander zusammengefasst,
+// damit eine Status-Box nicht mit einer Sensor-Box in ein Rechteck fällt.
+static void flushHomeChangesInBudget() {
+  unsigned long start = micros();
+  unsigned long budgetEnd = start + FrameBudgetConfig::BUDGET_US;
+  long pushed = 0;
+  memset(deferredHomeWidgets, 0, sizeof(deferredHomeWidgets));
+
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
+  for (int priority = 0; priority < PRIORITY_COUNT; priority++) {
+    frameState.renderManager.dirtyRectCount = 0;
+    for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+      if (homeWidgetPriority(w) == priority && homeWidgetChanged(w)) {
+        frameState.renderManager.markDirty(homeWidgetRect(w, offsetX, offsetY));
+      }
+    }
+    // Touch-Feedback immer zeichnen
+    pushed += flushDirtyRectList(priority != PRIORITY_TOUCH, budgetEnd);
   }
-  
-  if (renderManager.changes.fullScreen || renderManager.fullRedrawRequired) {
-    drawHomeScreen();
-    renderManager.clearAllFlags();
-    systemStatus.performance.totalRedraws++;
-    Serial.println("Vollständiger Screen-Redraw");
+  frameState.renderManager.dirtyRectCount = 0;
+  recordPartialFrame(pushed);
+
+  bool complete = true;
+  for (int w = 0; w < HOME_WIDGET_COUNT; w++) complete &= !deferredHomeWidgets[w];
+
+  unsigned long duration = micros() - start;
+  frameBudgetStats.budgetedFrames++;
+  frameBudgetStats.maxFrameMicros = max(frameBudgetStats.maxFrameMicros, duration);
+  if (duration > FrameBudgetConfig::BUDGET_US) frameBudgetStats.exceededFrames++;
+  if (!complete) frameBudgetStats.deferredFrames++;
+}
+
+// Nach clearAllFlags(): verschobene Widgets für den Folge-Frame markieren
+static void markDeferredHomeWidgets() {
+  for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+    if (!deferredHomeWidgets[w]) continue;
+    deferredHomeWidgets[w] = false;
+    frameBudgetStats.deferredWidgets++;
+
+    if (w < System::SENSOR_COUNT) {
+      frameState.renderManager.markSensorChanged(w, FrameBudgetConfig::DEFERRED_DEADLINE_MS);
+    } else {
+      switch (w) {
+        case WIDGET_SYSTEM_INFO:    frameState.renderManager.changes.systemInfo = true; break;
+        case WIDGET_NETWORK_STATUS: frameState.renderManager.changes.networkStatus = true; break;
+        case WIDGET_TIME:           frameState.renderManager.changes.time = true; break;
+        case WIDGET_DEBUG_HUD:      frameState.renderManager.changes.debugHud = true; break;
+      }
+      frameState.renderManager.scheduleFrame(FrameBudgetConfig::DEFERRED_DEADLINE_MS);
+    }
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RETAINED DETAIL-SCREENS
+// ═══════════════════════════════════════════════════════════════════════════════
+// Detail-Screens bestehen aus Layern in Zeichenreihenfolge. Statische Layer
+// (Titel, Beschriftungen) werden nur beim Vollbild gezeichnet; Layer mit
+// Signatur werden neu gezeichnet, sobald sich die Signatur ihrer angezeigten
+// Werte ändert. Der Neuzeichen-Pfad ist derselbe wie beim Home-Screen:
+// Dirty-Rechteck löschen und alle überlappenden Layer geclippt wiederholen.
+
+struct ScreenLayer {
+  DirtyRect rect;              // Hülle aller Pixel des Layers (bei jedem Offset)
+  void (*draw)();
+  uint32_t (*signature)();     // nullptr = statisch
+  bool cached;                 // Vollbilder aus dem Layer-Cache (teure Charts)
+};
+
+struct DetailScreen {
+  const ScreenLayer* layers;
+  int layerCount;
+  void (*drawFull)();          // öffentliche draw*Screen()-Funktion
+};
+
+constexpr int MAX_SCREEN_LAYERS = 8;
+
+static const DetailScreen* retainedScreen = nullptr;
+static uint32_t layerSignatures[MAX_SCREEN_LAYERS];
+
+// Definiert am Dateiende, nach den Layer-Tabellen der Screens
+static const DetailScreen* detailScreenFor(DisplayMode mode);
+
+// FNV-1a über die angezeigten Werte eines Layers
+struct LayerSignature {
+  uint32_t hash = 2166136261u;
+
+  LayerSignature& add(const void* data, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++) {
+      hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return *this;
+  }
+  LayerSignature& add(const char* text) { return add(text, strlen(text) + 1); }
+  LayerSignature& add(int value) { return add(&value, sizeof(value)); }
+};
+
+// Display-Listen: was das Panel zeigt (shown) und Platz für den neuen Frame.
+// Ein Segment je Layer, damit eine längere Zeichenkette nur die Befehle
+// ihres eigenen Layers verschiebt.
+static_assert(MAX_SCREEN_LAYERS <= DisplayListConfig::MAX_SEGMENTS, "Ein Segment je Layer");
+
+static DisplayList displayLists[2];
+static int shownList = 0;
+static bool displayListValid = false;
+static DisplayListRecorder displayListRecorder;
+
+static void storeLayerSignatures(const DetailScreen& screen) {
+  for (int i = 0; i < screen.layerCount; i++) {
+    const ScreenLayer& layer = screen.layers[i];
+    layerSignatures[i] = layer.signature ? layer.signature() : 0;
+  }
+}
+
+// Zeichnet alle Layer in die freie Liste (keine Pixel, kein SPI)
+static DisplayList& recordDetailScreen(const DetailScreen& screen) {
+  DisplayList& list = displayLists[1 - shownList];
+  displayListRecorder.begin(list);
+  {
+    CanvasScope scope(displayListRecorder, false);
+    for (int i = 0; i < screen.layerCount; i++) {
+      list.beginSegment();
+      screen.layers[i].draw();
+    }
+  }
+
+  if (list.overflow) displayListStats.overflows++;
+  displayListStats.maxCommands = max(displayListStats.maxCommands, list.count);
+  return list;
+}
+
+// Die zuletzt aufgezeichnete Liste entspricht ab jetzt dem Panel-Inhalt
+static void showRecordedList() {
+  shownList = 1 - shownList;
+  displayListValid = !displayLists[shownList].overflow;
+}
+
+// Vollbild: Hintergrund löschen, alle Layer zeichnen, Signaturen merken
+static void drawDetailLayers(const DetailScreen& screen) {
+  tft.fillScreen(Colors::BG_MAIN);
+  for (int i = 0; i < screen.layerCount; i++) {
+    screen.layers[i].draw();
+  }
+  storeLayerSignatures(screen);
+  retainedScreen = &screen;
+  displayListValid = false;  // ohne Aufzeichnung gezeichnet
+}
+
+// Layer-Cache: ein als 'cached' markierter Layer je Screen wird bei Band-
+// Vollbildern als Paletten-Puffer aufgenommen und beim nächsten Vollbild mit
+// gleichem Schlüssel (z.B. Rückkehr auf den Screen) expandiert statt neu
+// gezeichnet. Ein Eintrag für alle Screens - sichtbar ist immer nur einer.
+static uint8_t detailLayerCachePixels[PaletteBufferConfig::DETAIL_CACHE_BYTES];
+PaletteBuffer detailLayerCache(detailLayerCachePixels, PaletteBufferConfig::DETAIL_CACHE_BYTES);
+
+// Während eines Band-Vollbilds: gecachter Layer (-1 = keiner) und ob er aus
+// dem Cache kommt oder aufgenommen wird
+static int cachedLayerIndex = -1;
+static bool cachedLayerRestoring = false;
+
+// Der Puffer hält alles, was bis einschließlich des Layers in seiner Hülle
+// liegt: Schlüssel über Screen, Offset und die Signaturen aller bis dahin
+// gezeichneten Layer, die die Hülle schneiden (statische sind konstant)
+static uint32_t detailLayerCacheKey(const DetailScreen& screen, int index) {
+  const DirtyRect& rect = screen.layers[index].rect;
+  const DetailScreen* screenId = &screen;
+
+  LayerSignature signature;
+  signature.add(&screenId, sizeof(screenId)).add(index);
+  signature.add(frameState.antiBurnin.getOffsetX()).add(frameState.antiBurnin.getOffsetY());
+  for (int i = 0; i <= index; i++) {
+    const ScreenLayer& layer = screen.layers[i];
+    if (layer.signature != nullptr && layer.rect.intersects(rect)) {
+      signature.add((int)layer.signature());
+    }
+  }
+  return signature.hash;
+}
+
+static void beginDetailLayerCache(const DetailScreen& screen) {
+  cachedLayerIndex = -1;
+  cachedLayerRestoring = false;
+  if (!PaletteBufferConfig::ENABLED) return;
+
+  for (int i = 0; i < screen.layerCount; i++) {
+    if (!screen.layers[i].cached) continue;
+
+    uint32_t key = detailLayerCacheKey(screen, i);
+    cachedLayerRestoring = detailLayerCache.matches(key);
+    if (cachedLayerRestoring || detailLayerCache.beginCapture(screen.layers[i].rect, key)) {
+      cachedLayerIndex = i;
+    }
     return;
   }
-  
-  // Selektive Updates
+}
+
+static void finishDetailLayerCache(bool drawn) {
+  if (cachedLayerIndex >= 0) {
+    if (cachedLayerRestoring) {
+      if (drawn) detailLayerCache.restores++;
+    } else if (drawn) {
+      detailLayerCache.finishCapture();
+    } else {
+      detailLayerCache.clear();
+    }
+  }
+  cachedLayerIndex = -1;
+  cachedLayerRestoring = false;
+}
+
+// Vollbild per Band-Renderer: jedes Band löschen und nur die Layer zeichnen,
+// deren Hülle das Band schneidet
+static void drawDetailBand(const DirtyRect& band, const void* context) {
+  const DetailScreen& screen = *(const DetailScreen*)context;
+  canvas().fillRect(band.x, band.y, band.w, band.h, Colors::BG_MAIN);
+
+  for (int i = 0; i < screen.layerCount; i++) {
+    if (!screen.layers[i].rect.intersects(band)) continue;
+
+    if (i == cachedLayerIndex && cachedLayerRestoring) {
+      detailLayerCache.copyTo(*currentBandSprite(), 0, band.y);
+      continue;
+    }
+    screen.layers[i].draw();
+    if (i == cachedLayerIndex) {
+      detailLayerCache.captureFrom(*currentBandSprite(), 0, band.y);
+    }
+  }
+}
+
+static bool drawDetailLayersInBands(const DetailScreen& screen) {
+  beginDetailLayerCache(screen);
+  bool drawn = renderFrameInBands(drawDetailBand, &screen);
+  finishDetailLayerCache(drawn);
+  if (!drawn) return false;
+
+  storeLayerSignatures(screen);
+  retainedScreen = &screen;
+  return true;
+}
+
+static void collectDetailDirtyRects(const DetailScreen& screen) {
+  for (int i = 0; i < screen.layerCount; i++) {
+    const ScreenLayer& layer = screen.layers[i];
+    if (layer.signature == nullptr) continue;
+
+    uint32_t signature = layer.signature();
+    if (signature != layerSignatures[i]) {
+      layerSignatures[i] = signature;
+      frameState.renderManager.markDirty(layer.rect);
+    }
+  }
+}
+
+static void flushDetailDirtyRects(const DetailScreen& screen) {
+  long pushed = 0;
+
+  for (int r = 0; r < frameState.renderManager.dirtyRectCount; r++) {
+    const DirtyRect& rect = frameState.renderManager.dirtyRects[r];
+    tft.setViewport(rect.x, rect.y, rect.w, rect.h, false);
+    tft.fillRect(rect.x, rect.y, rect.w, rect.h, Colors::BG_MAIN);
+
+    for (int i = 0; i < screen.layerCount; i++) {
+      if (screen.layers[i].rect.intersects(rect)) {
+        screen.layers[i].draw();
+        systemStatus.performance.totalRedraws++;
+      }
+    }
+
+    tft.resetViewport();
+    pushed += rect.area();
+  }
+
+  recordPartialFrame(pushed);
+}
+
+// Vollbild-Anfrage auf demselben Screen: neuen Frame aufzeichnen, mit dem
+// angezeigten vergleichen und nur abweichende Bereiche zeichnen. false wenn
+// kein Vergleich möglich ist oder sich zu viel geändert hat.
+static bool redrawDetailScreenByDiff(const DetailScreen& screen, const DisplayList& recorded) {
+  int differing = diffDisplayLists(displayLists[shownList], recorded, frameState.renderManager);
+  if (differing < 0 || frameState.renderManager.dirtyPixelCount() > DisplayListConfig::MAX_DIFF_PIXELS) {
+    frameState.renderManager.dirtyRectCount = 0;
+    return false;
+  }
+
+  flushDetailDirtyRects(screen);
+  storeLayerSignatures(screen);
+  showRecordedList();
+
+  displayListStats.diffedRedraws++;
+  if (differing == 0) displayListStats.unchangedRedraws++;
+  return true;
+}
+
+static void renderDetailScreen(const DetailScreen& screen) {
+  bool sameContent = retainedScreen == &screen && displayListValid &&
+                     !frameState.renderManager.changes.panelOverwritten && !frameState.renderManager.fullRedrawRequired;
+  bool fullRedraw = frameState.renderManager.changes.fullScreen || frameState.renderManager.fullRedrawRequired ||
+                    frameState.renderManager.changes.antiBurnin || retainedScreen != &screen;
+  if (fullRedraw) {
+    const DisplayList& recorded = recordDetailScreen(screen);
+    if (sameContent && redrawDetailScreenByDiff(screen, recorded)) return;
+
+    // Ohne Band-Sprite (kein RAM) direkt mit Löschen des ganzen Screens
+    if (!drawDetailLayersInBands(screen)) {
+      screen.drawFull();
+    }
+    showRecordedList();
+    recordFullFrame();
+    displayListStats.fullRedraws++;
+    return;
+  }
+
+  collectDetailDirtyRects(screen);
+  bool changed = frameState.renderManager.dirtyRectCount > 0;
+  flushDetailDirtyRects(screen);
+
+  // Liste nachführen, damit der nächste Vergleich vom Panel-Inhalt ausgeht
+  if (changed) {
+    recordDetailScreen(screen);
+    showRecordedList();
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              HOME-SCREEN CHROME UND VOLLBILD-CACHE
+// ═══════════════════════════════════════════════════════════════════════════════
+// Hintergrund, Box-Flächen, Rahmen, Labels und die Settings-Box liegen
+// vorgerendert im Chrome-Layer. Sensor-Boxen befüllen ihren Sprite daraus und
+// zeichnen nur noch Wert, Trend und Balken. Ein Vollbild ist ein einziger
+// Band-Durchlauf aus Layer und dynamischen Teilen, ohne fillScreen.
+//
+// Jedes so gezeichnete Vollbild wird nebenbei im Frame-Layer aufgenommen. Die
+// Rückkehr von einem Detail-Screen ist dann ein Blit dieses Layers; danach
+// werden die dynamischen Widgets wie bei einem normalen Update nachgezogen
+// (unveränderte Kacheln überspringt der Kachel-Cache).
+
+static uint16_t homeChromeRuns[CachedLayerConfig::CHROME_RUNS];
+static uint16_t homeFrameRuns[CachedLayerConfig::FRAME_RUNS];
+CachedLayer homeChromeLayer(homeChromeRuns, CachedLayerConfig::CHROME_RUNS);
+CachedLayer homeFrameLayer(homeFrameRuns, CachedLayerConfig::FRAME_RUNS);
+
+static bool chromeCaptureFailed = false;
+static uint32_t failedChromeKey = 0;
+
+// Definiert bei den Sensor-Komponenten
+static bool isSensorBoxClosed(int index);
+static void renderSensorChrome(int index, int boxX, int boxY);
+static void renderSensorContent(int index, int boxX, int boxY);
+
+// Alles, wovon die Chrome abhängt: Offset, Labels, Timeout- und Börsenzustand
+static uint32_t homeChromeKey() {
+  LayerSignature signature;
+  signature.add(frameState.antiBurnin.getOffsetX()).add(frameState.antiBurnin.getOffsetY());
   for (int i = 0; i < System::SENSOR_COUNT; i++) {
-    if (renderManager.changes.sensors[i] || sensors[i].needsRedraw()) {
-      drawSensorBox(i);
-      sensors[i].markRendered();
-      systemStatus.performance.totalRedraws++;
+    signature.add(frameState.sensors[i].label).add((int)frameState.sensors[i].isTimedOut).add((int)isSensorBoxClosed(i));
+  }
+  return signature.hash;
+}
+
+static void drawHomeChromeBand(const DirtyRect& band, const void* context) {
+  (void)context;
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
+  canvas().fillRect(band.x, band.y, band.w, band.h, Colors::BG_MAIN);
+
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    if (homeWidgetRect(i, offsetX, offsetY).intersects(band)) {
+      renderSensorChrome(i, frameState.sensors[i].layout.x + offsetX, frameState.sensors[i].layout.y + offsetY);
+    }
+  }
+  if (homeWidgetRect(WIDGET_SETTINGS, offsetX, offsetY).intersects(band)) {
+    drawSettingsBox();
+  }
+}
+
+// Chrome für den aktuellen Zustand (bei Bedarf neu aufgenommen);
+// nullptr wenn kein Layer verfügbar ist - dann wird vollständig gezeichnet
+static const CachedLayer* currentHomeChrome() {
+  if (!CachedLayerConfig::ENABLED) return nullptr;
+
+  uint32_t key = homeChromeKey();
+  if (homeChromeLayer.matches(key)) return &homeChromeLayer;
+  if (chromeCaptureFailed && failedChromeKey == key) return nullptr;
+
+  if (!captureFrameInBands(drawHomeChromeBand, nullptr, homeChromeLayer, key)) {
+    chromeCaptureFailed = true;
+    failedChromeKey = key;
+    Serial.printf("WARNUNG - Chrome-Layer nicht verfügbar (%d Läufe), zeichne Boxen vollständig\n",
+                  homeChromeLayer.runCount());
+    return nullptr;
+  }
+  chromeCaptureFailed = false;
+  return &homeChromeLayer;
+}
+
+// Vollbild-Band: die Chrome steht schon im Band, nur dynamische Teile zeichnen
+static void drawHomeBand(const DirtyRect& band, const void* context) {
+  (void)context;
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
+
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    if (homeWidgetRect(i, offsetX, offsetY).intersects(band)) {
+      renderSensorContent(i, frameState.sensors[i].layout.x + offsetX, frameState.sensors[i].layout.y + offsetY);
+    }
+  }
+  if (homeWidgetRect(WIDGET_SYSTEM_INFO, offsetX, offsetY).intersects(band)) drawSystemInfo();
+  if (homeWidgetRect(WIDGET_NETWORK_STATUS, offsetX, offsetY).intersects(band)) drawNetworkStatus();
+  if (homeWidgetRect(WIDGET_TIME, offsetX, offsetY).intersects(band)) drawTimeDisplay();
+  // Ausgeblendet liegt dort schon der Hintergrund der Chrome
+  if (frameState.debugHudVisible && homeWidgetRect(WIDGET_DEBUG_HUD, offsetX, offsetY).intersects(band)) {
+    drawDebugHud();
+  }
+}
+
+// Signatur der angezeigten Inhalte je Home-Widget beim Aufnehmen des Frame-Layers
+static uint32_t capturedWidgetSignatures[HOME_WIDGET_COUNT];
+
+// Hash über die Zeichenbefehle der dynamischen Teile eines Widgets (per
+// Display-List-Recorder, ohne Pixel). Die Chrome ist über den Layer-
+// Schlüssel abgedeckt. 0 = unbekannt (Liste übergelaufen).
+static uint32_t homeWidgetSignature(int widget) {
+  // Freie Liste der Detail-Screens als Zwischenspeicher
+  DisplayList& scratch = displayLists[1 - shownList];
+  displayListRecorder.begin(scratch);
+  scratch.beginSegment();
+  {
+    CanvasScope scope(displayListRecorder, false);
+    if (widget < System::SENSOR_COUNT) {
+      const SensorData& sensor = frameState.sensors[widget];
+      renderSensorContent(widget, sensor.layout.x + frameState.antiBurnin.getOffsetX(),
+                          sensor.layout.y + frameState.antiBurnin.getOffsetY());
     } else {
-      systemStatus.performance.skippedRedraws++;
+      switch (widget) {
+        case WIDGET_SYSTEM_INFO:    drawSystemInfo(); break;
+        case WIDGET_NETWORK_STATUS: drawNetworkStatus(); break;
+        case WIDGET_TIME:           drawTimeDisplay(); break;
+        case WIDGET_DEBUG_HUD:      drawDebugHud(); break;
+      }
     }
   }
-  
-  bool hasUpdates = false;
-  
-  if (renderManager.changes.systemInfo) {
-    drawSystemInfo();
-    hasUpdates = true;
+  if (scratch.overflow) return 0;
+
+  LayerSignature signature;
+  signature.add(scratch.commands, scratch.count * sizeof(DisplayCommand));
+  return signature.hash != 0 ? signature.hash : 1;
+}
+
+static bool drawHomeScreenInBands() {
+  const CachedLayer* chrome = currentHomeChrome();
+  if (chrome == nullptr) return false;
+
+  // Gleicher Schlüssel wie die Chrome: Offset und Box-Zustände stimmen überein.
+  // Während ein Screenshot den Frame-Layer sendet, ohne Aufnahme zeichnen.
+  bool captureFrame = !isLayerLentToScreenshot(&homeFrameLayer);
+  if (captureFrame) homeFrameLayer.beginCapture(chrome->key());
+  if (!renderFrameInBands(drawHomeBand, nullptr, chrome, captureFrame ? &homeFrameLayer : nullptr)) {
+    if (captureFrame) homeFrameLayer.clear();
+    return false;
+  }
+  if (captureFrame && homeFrameLayer.finishCapture()) {
+    for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+      capturedWidgetSignatures[w] = homeWidgetSignature(w);
+    }
   }
-  
-  if (renderManager.changes.networkStatus) {
-    drawNetworkStatus();
-    hasUpdates = true;
+
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    frameState.sensors[i].markRendered();
   }
-  
-  
-  if (renderManager.changes.time) {
-    drawTimeDisplay();
-    hasUpdates = true;
+  cachedLayerStats.composedFrames++;
+  return true;
+}
+
+// Band ohne eigene Zeichenbefehle (Inhalt kommt komplett aus dem Layer)
+static void drawNothingBand(const DirtyRect& band, const void* context) {
+  (void)band;
+  (void)context;
+}
+
+// Zuletzt gezeichnetes Home-Vollbild zurückholen und die Widgets nachziehen,
+// deren Inhalt sich seit der Aufnahme geändert hat. false wenn der Frame-
+// Layer nicht zum aktuellen Zustand passt (anderer Offset, Timeout- oder
+// Börsenwechsel).
+static bool restoreHomeScreenFromCache() {
+  if (!CachedLayerConfig::ENABLED || !homeFrameLayer.matches(homeChromeKey())) return false;
+  if (!renderFrameInBands(drawNothingBand, nullptr, &homeFrameLayer)) return false;
+
+  // Direkt statt über Dirty-Rechtecke: zusammengefasste Rechtecke würden
+  // vor dem Neuzeichnen gelöscht und das gerade gezeigte Bild überblitzen
+  for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+    if (w == WIDGET_SETTINGS) continue;   // reine Chrome
+    uint32_t signature = homeWidgetSignature(w);
+    if (signature != 0 && signature == capturedWidgetSignatures[w]) {
+      if (w < System::SENSOR_COUNT) frameState.sensors[w].markRendered();
+      continue;
+    }
+    drawHomeWidget(w);
+    cachedLayerStats.restoredWidgets++;
+  }
+  cachedLayerStats.restoredFrames++;
+  return true;
+}
+
+// Steht das Panel-Bild noch unverändert im Frame-Layer? (alle Widgets wie bei
+// der Aufnahme; die Chrome deckt der Schlüssel ab)
+static bool homeFrameLayerIsCurrent() {
+  if (!homeFrameLayer.matches(homeChromeKey())) return false;
+  for (int w = 0; w < HOME_WIDGET_COUNT; w++) {
+    if (w == WIDGET_SETTINGS) continue;
+    uint32_t signature = homeWidgetSignature(w);
+    if (signature == 0 || signature != capturedWidgetSignatures[w]) return false;
+  }
+  return true;
+}
+
+const CachedLayer* captureMainScreen(CachedLayer& scratch) {
+  if (frameState.currentMode == HOME_SCREEN) {
+    if (homeFrameLayerIsCurrent()) return &homeFrameLayer;
+
+    const CachedLayer* chrome = currentHomeChrome();
+    if (chrome == nullptr) return nullptr;
+    if (!captureFrameInBands(drawHomeBand, nullptr, scratch, chrome->key(), chrome)) return nullptr;
+    return &scratch;
+  }
+
+  const DetailScreen* screen = detailScreenFor(frameState.currentMode);
+  if (screen == nullptr) return nullptr;
+  if (!captureFrameInBands(drawDetailBand, screen, scratch, (uint32_t)frameState.currentMode)) return nullptr;
+  return &scratch;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              ENERGIEFLUSS-PANEL
+// ═══════════════════════════════════════════════════════════════════════════════
+// Szene des zweiten Panels: Haus in der Mitte, PV, Netz, Speicher und Wallbox
+// ringsum, Pfeile in Flussrichtung. Die Szene wird nur neu aufgebaut, wenn
+// sich ein angezeigter Text oder eine Richtung ändert; den Rest filtert der
+// Kachel-Cache des Panels.
+
+namespace EnergyFlowConfig {
+  constexpr bool ENABLED = PanelConfig::COUNT > PanelConfig::ENERGY_FLOW;
+  constexpr int NODE_WIDTH = 80;
+  constexpr int NODE_HEIGHT = 48;
+  constexpr int LINK_WIDTH = 3;
+  constexpr int ARROW_SIZE = 6;
+}
+
+enum EnergyFlowNode {
+  FLOW_PV = 0,
+  FLOW_GRID,
+  FLOW_STORAGE,
+  FLOW_WALLBOX,
+  FLOW_HOUSE,          // Mittelpunkt, ohne eigene Verbindung
+  FLOW_NODE_COUNT
+};
+
+struct EnergyFlowNodeLayout {
+  const char* label;
+  int16_t x, y;
+};
+
+static constexpr EnergyFlowNodeLayout ENERGY_FLOW_NODES[FLOW_NODE_COUNT] = {
+  {"PV",       120,  28},
+  {"Netz",       8, 100},
+  {"Speicher", 232, 100},
+  {"Wallbox",  120, 172},
+  {"Haus",     120, 100},
+};
+
+static_assert(ENERGY_FLOW_NODES[FLOW_STORAGE].x + EnergyFlowConfig::NODE_WIDTH <= Layout::DISPLAY_WIDTH &&
+              ENERGY_FLOW_NODES[FLOW_WALLBOX].y + EnergyFlowConfig::NODE_HEIGHT <= Layout::DISPLAY_HEIGHT,
+              "Energiefluss-Knoten liegen außerhalb des Panels");
+
+// Alles, was die Szene zeigt - gleiche Bytes, gleiches Bild
+struct EnergyFlowState {
+  char values[FLOW_NODE_COUNT][12];
+  char storageLevel[8];
+  int8_t direction[FLOW_NODE_COUNT];    // +1 zum Haus, -1 vom Haus, 0 kein Fluss
+  uint16_t color[FLOW_NODE_COUNT];
+};
+
+static EnergyFlowState energyFlowState;
+static uint32_t energyFlowSignature = 0;
+
+static void setFlowNode(EnergyFlowState& state, int node, float power, int direction, uint16_t color) {
+  bool active = power >= PowerManagement::MIN_CONSUMPTION_THRESHOLD;
+  snprintf(state.values[node], sizeof(state.values[node]), "%.*f kW",
+           PowerManagement::POWER_DISPLAY_PRECISION, power);
+  state.direction[node] = active ? direction : 0;
+  state.color[node] = active ? color : Colors::TEXT_TIMEOUT;
+}
+
+static void buildEnergyFlowState(EnergyFlowState& state) {
+  memset(&state, 0, sizeof(state));   // Signatur über alle Bytes
+  setFlowNode(state, FLOW_PV, frameState.pvPower, +1, Colors::STATUS_YELLOW);
+  setFlowNode(state, FLOW_GRID, frameState.gridPower, frameState.isGridFeedIn ? -1 : +1,
+              frameState.isGridFeedIn ? Colors::STATUS_GREEN : Colors::STATUS_RED);
+  setFlowNode(state, FLOW_STORAGE, frameState.storagePower, frameState.isStorageCharging ? -1 : +1, Colors::STATUS_CYAN);
+  setFlowNode(state, FLOW_WALLBOX, frameState.wallboxPower, -1, Colors::STATUS_BLUE);
+  setFlowNode(state, FLOW_HOUSE, frameState.loadPower, 0, Colors::TEXT_MAIN);
+  state.color[FLOW_HOUSE] = Colors::TEXT_MAIN;
+
+  const SensorData& battery = frameState.sensors[3];
+  if (!battery.isTimedOut) {
+    snprintf(state.storageLevel, sizeof(state.storageLevel), "%d%%", (int)(battery.value + 0.5f));
+  }
+}
+
+static DirtyRect flowNodeRect(int node) {
+  return DirtyRect(ENERGY_FLOW_NODES[node].x, ENERGY_FLOW_NODES[node].y,
+                   EnergyFlowConfig::NODE_WIDTH, EnergyFlowConfig::NODE_HEIGHT);
+}
+
+// Verbindung zwischen Knoten und Haus samt Richtungspfeil in der Mitte
+static void drawFlowLink(TFT_eSPI& gfx, const EnergyFlowState& state, int node) {
+  DirtyRect from = flowNodeRect(node);
+  DirtyRect house = flowNodeRect(FLOW_HOUSE);
+  uint16_t color = state.color[node];
+  const int half = EnergyFlowConfig::LINK_WIDTH / 2;
+  const int arrow = EnergyFlowConfig::ARROW_SIZE;
+
+  if (from.x == house.x) {
+    // Senkrecht (PV oben, Wallbox unten): +1 zeigt zum Haus
+    int top = min(from.bottom(), house.bottom());
+    int bottom = max(from.y, house.y);
+    int centerX = house.x + house.w / 2;
+    int centerY = (top + bottom) / 2;
+    gfx.fillRect(centerX - half, top, EnergyFlowConfig::LINK_WIDTH, bottom - top, color);
+    int down = ((from.y < house.y) == (state.direction[node] > 0)) ? 1 : -1;
+    if (state.direction[node] != 0) {
+      gfx.fillTriangle(centerX - arrow, centerY - down * arrow / 2, centerX + arrow, centerY - down * arrow / 2,
+                       centerX, centerY + down * arrow, color);
+    }
+  } else {
+    // Waagrecht (Netz links, Speicher rechts)
+    int left = min(from.right(), house.right());
+    int right = max(from.x, house.x);
+    int centerX = (left + right) / 2;
+    int centerY = house.y + house.h / 2;
+    gfx.fillRect(left, centerY - half, right - left, EnergyFlowConfig::LINK_WIDTH, color);
+    int toRight = ((from.x < house.x) == (state.direction[node] > 0)) ? 1 : -1;
+    if (state.direction[node] != 0) {
+      gfx.fillTriangle(centerX - toRight * arrow / 2, centerY - arrow, centerX - toRight * arrow / 2, centerY + arrow,
+                       centerX + toRight * arrow, centerY, color);
+    }
+  }
+}
+
+static void drawFlowNode(TFT_eSPI& gfx, const EnergyFlowState& state, int node) {
+  DirtyRect rect = flowNodeRect(node);
+  gfx.fillRect(rect.x, rect.y, rect.w, rect.h, Colors::BG_ROW2);
+  gfx.drawRect(rect.x, rect.y, rect.w, rect.h, state.color[node]);
+
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  if (node == FLOW_STORAGE && state.storageLevel[0] != '\0') {
+    // "Speicher" plus Ladestand passt nicht in die Knotenbreite
+    char label[20];
+    snprintf(label, sizeof(label), "Akku %s", state.storageLevel);
+    gfx.drawString(label, rect.x + 6, rect.y + 5, 2);
+  } else {
+    gfx.drawString(ENERGY_FLOW_NODES[node].label, rect.x + 6, rect.y + 5, 2);
+  }
+  gfx.setTextColor(Colors::TEXT_MAIN);
+  gfx.drawString(state.values[node], rect.x + 6, rect.y + 26, 2);
+}
+
+static void drawEnergyFlowBand(const DirtyRect& band, const void* context) {
+  const EnergyFlowState& state = *(const EnergyFlowState*)context;
+  TFT_eSPI& gfx = canvas();
+
+  gfx.fillRect(band.x, band.y, band.w, band.h, Colors::BG_MAIN);
+  if (band.y < 20) {
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Energiefluss", 8, 6, 2);
+  }
+
+  for (int node = 0; node < FLOW_HOUSE; node++) {
+    drawFlowLink(gfx, state, node);
+  }
+  for (int node = 0; node < FLOW_NODE_COUNT; node++) {
+    if (flowNodeRect(node).intersects(band)) drawFlowNode(gfx, state, node);
+  }
+}
+
+// Pro Frame: bei geänderten Werten die Szene des Panels neu anmelden. Gezeichnet
+// wird im Band-Durchlauf des Hauptpanels oder am Ende des Frames.
+static void updateEnergyFlowScene() {
+  if (!EnergyFlowConfig::ENABLED) return;
+
+  EnergyFlowState state;
+  buildEnergyFlowState(state);
+  uint32_t signature = LayerSignature().add(&state, sizeof(state)).hash;
+  if (signature == energyFlowSignature) return;
+
+  energyFlowState = state;
+  energyFlowSignature = signature;
+  setPanelScene(PanelConfig::ENERGY_FLOW, drawEnergyFlowBand, &energyFlowState);
+  markPanelSceneDirty(PanelConfig::ENERGY_FLOW);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              HAUPT-RENDER-FUNKTIONEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static void updateMainPanel();
+
+FrameState frameState;
+
+// Live-Daten in den Frame kopieren; Change-Flags (RenderManager und
+// Sensor-Redraw) wandern in den Frame und werden live zurückgesetzt
+static void takeFrameState() {
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    frameState.sensors[i] = sensors[i];
+    sensors[i].requiresRedraw = false;
+    sensors[i].hasChanged = false;
+  }
+  frameState.systemStatus = systemStatus;
+  frameState.antiBurnin = antiBurnin;
+  renderManager.handOverChanges(frameState.renderManager);
+  frameState.currentMode = currentMode;
+  frameState.dayAheadPrices = dayAheadPrices;
+
+  frameState.stockPreviousClose = stockPreviousClose;
+  frameState.pvPower = pvPower;
+  frameState.gridPower = gridPower;
+  frameState.loadPower = loadPower;
+  frameState.storagePower = storagePower;
+  frameState.wallboxPower = wallboxPower;
+  frameState.isGridFeedIn = isGridFeedIn;
+  frameState.isStorageCharging = isStorageCharging;
+
+  frameState.otaActive = isOTAActive();
+  snprintf(frameState.otaStatus, sizeof(frameState.otaStatus), "%s", getOTAStatus().c_str());
+  frameState.calibrating = touchManager.isCalibrating();
+  frameState.calibrated = touchManager.hasValidCalibration();
+  frameState.debugHudVisible = isDebugHudVisible();
+  snprintf(frameState.debugHudText, sizeof(frameState.debugHudText), "%s", debugHudText());
+}
+
+// Nicht Gezeichnetes und für Folge-Frames Markiertes zurückgeben
+static void returnFrameChanges() {
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    const SensorData& drawn = frameState.sensors[i];
+    sensors[i].previousRenderValue = drawn.previousRenderValue;
+    sensors[i].requiresRedraw = sensors[i].requiresRedraw || drawn.requiresRedraw;
+    sensors[i].hasChanged = sensors[i].hasChanged || drawn.hasChanged;
+  }
+  renderManager.takeBackChanges(frameState.renderManager);
+  // loop() schläft evtl. schon: Folge-Frame (Frame-Budget, Screenshot) einplanen lassen
+  if (frameState.renderManager.frameScheduled) wakeFrameScheduler();
+}
+
+void updateDisplay() {
+  {
+    DisplayLock lock;
+    takeFrameState();
+  }
+
+  // Während eines OTA-Uploads gehört das Panel dem OTA-Bildschirm: Frame
+  // auslassen, die Änderungen bleiben für den Frame danach erhalten
+  bool otaBeforeFrame = isOTAInProgress();
+  if (!otaBeforeFrame) {
+    ProfileScope profile(PROFILE_FRAME);
+    unsigned long start = micros();
+    // PanelLock und startWrite() nur für Schreibzugriffe und laufende DMA;
+    // Sprite- und Band-Rasterung gibt das Panel frei (RasterScope)
+    beginPanelFrame();
+    updateChartClock();
+    updateEnergyFlowScene();
+
+    updateMainPanel();
+    flushPanelScenes();
+    endPanelFrame();
+    noteHudFrame(micros() - start);
+    updateScreenshotCapture();
+  }
+
+  DisplayLock lock;
+  // Upload während einer Freigabe gestartet: der Frame hat danach noch über
+  // den OTA-Bildschirm gezeichnet
+  if (!otaBeforeFrame && isOTAInProgress()) displayOTAProgress();
+  returnFrameChanges();
+}
+
+static void updateMainPanel() {
+  if (frameState.currentMode != HOME_SCREEN) {
+    const DetailScreen* screen = detailScreenFor(frameState.currentMode);
+    if (screen == nullptr) return;
+
+    renderDetailScreen(*screen);
+    frameState.renderManager.clearAllFlags();
+    return;
+  }
+
+  // Rückkehr von einem Detail-Screen: letztes Home-Vollbild per Blit
+  bool returningHome = retainedScreen != nullptr;
+  retainedScreen = nullptr;
+
+  if (frameState.renderManager.changes.fullScreen || frameState.renderManager.fullRedrawRequired) {
+    if (returningHome && restoreHomeScreenFromCache()) {
+      recordFullFrame();
+      frameState.renderManager.clearAllFlags();
+      systemStatus.performance.totalRedraws++;
+      return;
+    }
+    drawHomeScreen();
+    recordFullFrame();
+    frameState.renderManager.clearAllFlags();
+    systemStatus.performance.totalRedraws++;
+    Serial.println("Vollständiger Screen-Redraw");
+    return;
   }
   
-  // OTA-Status ist jetzt in drawNetworkStatus() integriert
-  
-  // Selektiver Redraw-Ausgabe entfernt - LDR-Wert wird jetzt im main loop alle 3 Sekunden ausgegeben
-  
-  renderManager.clearAllFlags();
+  // Anti-Burnin: das ganze Bild mit neuem Offset in einem Band-Durchlauf aus
+  // dem Chrome-Layer neu aufbauen - alte Positionen werden nicht erst gelöscht
+  // (kein Aufblitzen), unveränderte Kacheln überspringt der Kachel-Cache
+  if (frameState.renderManager.changes.antiBurnin && drawHomeScreenInBands()) {
+    recordFullFrame();
+    frameState.renderManager.clearAllFlags();
+    systemStatus.performance.totalRedraws++;
+    return;
+  }
+
+  // Selektive Updates: Änderungen als zusammengefasste Dirty-Rechtecke neu
+  // zeichnen (ohne Band-Sprite auch die Anti-Burnin-Verschiebung)
+  if (!FrameBudgetConfig::ENABLED || frameState.renderManager.changes.antiBurnin) {
+    collectHomeDirtyRects();
+    flushDirtyRects();
+    frameState.renderManager.clearAllFlags();
+    return;
+  }
+
+  // Sonst nach Vorrang im Frame-Budget, Rest im Folge-Frame
+  flushHomeChangesInBudget();
+  frameState.renderManager.clearAllFlags();
+  markDeferredHomeWidgets();
 }
 
 void drawHomeScreen() {
   Serial.println("Zeichne Home-Screen...");
-  
-  tft.fillScreen(Colors::BG_MAIN);
-  
-  int offsetX = antiBurnin.getOffsetX();
 
   // Titel entfernt auf User-Anfrage
 
   // TEST: Zeige kombinierte Layouts als Demonstration
   // Aktiviere dies temporär zum Testen der Kombinationen
   bool testCombinedLayout = false; // DEAKTIVIERT - zurück zum normalen Layout
+
+  // Normalfall: ein Band-Durchlauf aus Chrome-Layer und dynamischen Teilen
+  if (!testCombinedLayout && drawHomeScreenInBands()) {
+    Serial.println("Home-Screen vollständig gezeichnet (Chrome-Layer)");
+    return;
+  }
+
+  tft.fillScreen(Colors::BG_MAIN);
   
   if (testCombinedLayout) {
     // Test kombinierte Layouts
@@ -164,51 +1076,27 @@ void drawHomeScreen() {
     for (int i = 0; i < System::SENSOR_COUNT; i++) {
       if (i != 0 && i != 1 && i != 6 && i != 7) { // Skip die kombinierten
         drawSensorBox(i);
-        sensors[i].markRendered();
+        frameState.sensors[i].markRendered();
       }
     }
     
     // Markiere auch die kombinierten als gerendert
-    sensors[0].markRendered();
-    sensors[1].markRendered();
-    sensors[6].markRendered();
-    sensors[7].markRendered();
+    frameState.sensors[0].markRendered();
+    frameState.sensors[1].markRendered();
+    frameState.sensors[6].markRendered();
+    frameState.sensors[7].markRendered();
+    finishPanelDMA();
     
   } else {
     // Normale Layout: Alle Komponenten einzeln zeichnen
     for (int i = 0; i < System::SENSOR_COUNT; i++) {
       drawSensorBox(i);
-      sensors[i].markRendered();
+      frameState.sensors[i].markRendered();
     }
+    finishPanelDMA();
 
     // Settings-Box in der freien Ecke (Position [2,2])
-    int settingsX = 220 + offsetX;
-    int settingsY = 135;
-    tft.drawRoundRect(settingsX, settingsY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT,
-                      Layout::SENSOR_BOX_RADIUS, Colors::BORDER_MAIN);
-
-    // Settings-Symbol (Zahnrad-ähnlich)
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Settings", settingsX + 5, settingsY + 5, 1);
-
-    // Gear-Symbol
-    uint16_t gearColor = Colors::TEXT_MAIN;
-    int gearX = settingsX + Layout::SENSOR_BOX_WIDTH - 20;
-    int gearY = settingsY + Layout::SENSOR_BOX_HEIGHT/2;
-
-    // Einfaches Zahnrad-Symbol mit Kreisen
-    tft.drawCircle(gearX, gearY, 8, gearColor);
-    tft.drawCircle(gearX, gearY, 4, gearColor);
-
-    // Zähne des Zahnrads
-    for (int i = 0; i < 8; i++) {
-      float angle = i * 45.0f * PI / 180.0f;
-      int x1 = gearX + cos(angle) * 6;
-      int y1 = gearY + sin(angle) * 6;
-      int x2 = gearX + cos(angle) * 10;
-      int y2 = gearY + sin(angle) * 10;
-      tft.drawLine(x1, y1, x2, y2, gearColor);
-    }
+    drawSettingsBox();
   }
 
   drawSystemInfo();
@@ -218,148 +1106,234 @@ void drawHomeScreen() {
   Serial.println("Home-Screen vollständig gezeichnet");
 }
 
-void drawPriceDetailScreen() {
-  Serial.println("Zeichne Preis-Detail-Screen...");
+void drawSettingsBox() {
+  TFT_eSPI& gfx = canvas();
+  const WidgetLayout& box = WIDGETS[WIDGET_SETTINGS];
+  int settingsX = box.x + frameState.antiBurnin.getOffsetX();
+  int settingsY = box.y;
+  gfx.drawRoundRect(settingsX, settingsY, box.w, box.h, Layout::SENSOR_BOX_RADIUS, Colors::BORDER_MAIN);
+
+  // Settings-Symbol (Zahnrad-ähnlich)
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Settings", settingsX + 5, settingsY + 5, 1);
+
+  // Gear-Symbol
+  uint16_t gearColor = Colors::TEXT_MAIN;
+  int gearX = settingsX + box.w - 20;
+  int gearY = settingsY + box.h/2;
+
+  // Einfaches Zahnrad-Symbol mit Kreisen
+  gfx.drawCircle(gearX, gearY, 8, gearColor);
+  gfx.drawCircle(gearX, gearY, 4, gearColor);
+
+  // Zähne des Zahnrads
+  for (int i = 0; i < 8; i++) {
+    float angle = i * 45.0f * PI / 180.0f;
+    int x1 = gearX + cos(angle) * 6;
+    int y1 = gearY + sin(angle) * 6;
+    int x2 = gearX + cos(angle) * 10;
+    int y2 = gearY + sin(angle) * 10;
+    gfx.drawLine(x1, y1, x2, y2, gearColor);
+  }
+}
 
-  tft.fillScreen(Colors::BG_MAIN);
+// Titel und Zurück-Button (oben rechts), gemeinsam für alle Detail-Screens
+static void drawDetailHeader(const char* title, int titleX) {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
 
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
+  gfx.setTextColor(Colors::TEXT_MAIN);
+  gfx.drawString(title, titleX + offsetX, 10 + offsetY, 2);
 
-  // Titel
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Strompreis Day-Ahead", Layout::PADDING_LARGE + offsetX, Layout::PADDING_LARGE + offsetY, 2);
+  DirtyRect backButton = WIDGETS[WIDGET_BACK_BUTTON].at(offsetX, offsetY);
+  gfx.drawRoundRect(backButton.x, backButton.y, backButton.w, backButton.h, 3, Colors::BORDER_MAIN);
+  gfx.setTextColor(Colors::TEXT_MAIN);
+  gfx.drawString("Zurueck", backButton.x + 3, backButton.y + 6, 1);
+}
 
-  // Zurück-Button (oben rechts)
-  int backButtonX = 270 + offsetX;
-  int backButtonY = 10 + offsetY;
-  tft.drawRoundRect(backButtonX, backButtonY, 40, 20, 3, Colors::BORDER_MAIN);
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Zurueck", backButtonX + 3, backButtonY + 6, 1);
+static void formatUpdateAge(char* buffer, size_t size, unsigned long lastUpdate) {
+  unsigned long age = (millis() - lastUpdate) / 1000;
+  if (age < 60) {
+    snprintf(buffer, size, "Update vor: %lus", age);
+  } else if (age < 3600) {
+    snprintf(buffer, size, "Update vor: %lum", age / 60);
+  } else {
+    snprintf(buffer, size, "Update vor: %luh", age / 3600);
+  }
+}
 
-  // Aktueller Preis (groß anzeigen)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Aktueller Preis:", Layout::PADDING_LARGE + offsetX, 40, 1);
-  tft.setTextColor(Colors::TEXT_MAIN);
-  const char* currentPriceText = sensors[1].formattedValue;
-  tft.drawString(currentPriceText, Layout::PADDING_LARGE + offsetX, 55, 3);
+// ── Preis-Detail-Screen ──
+
+static void drawPriceDetailChrome() {
+  TFT_eSPI& gfx = canvas();
+  drawDetailHeader("Strompreis Day-Ahead", Layout::PADDING_LARGE);
+
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Aktueller Preis:", Layout::PADDING_LARGE + frameState.antiBurnin.getOffsetX(), 40, 1);
+}
+
+static void drawPriceDetailValue() {
+  TFT_eSPI& gfx = canvas();
+  gfx.setTextColor(Colors::TEXT_MAIN);
+  gfx.drawString(frameState.sensors[1].formattedValue, Layout::PADDING_LARGE + frameState.antiBurnin.getOffsetX(), 55, 3);
+}
+
+static uint32_t priceDetailValueSignature() {
+  return LayerSignature().add(frameState.sensors[1].formattedValue).hash;
+}
+
+static void drawPriceDetailBody() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
 
   // Smart Analytics Display
-  if (dayAheadPrices.hasData && dayAheadPrices.lastAnalysis > 0) {
+  if (frameState.dayAheadPrices.hasData && frameState.dayAheadPrices.lastAnalysis > 0) {
     drawPriceAnalytics(offsetX);
-  } else if (dayAheadPrices.hasData) {
+  } else if (frameState.dayAheadPrices.hasData) {
     // Datum anzeigen (Legacy-Modus)
-    tft.setTextColor(Colors::TEXT_LABEL);
+    gfx.setTextColor(Colors::TEXT_LABEL);
     char dateText[64];
-    snprintf(dateText, sizeof(dateText), "Datum: %s", dayAheadPrices.date);
-    tft.drawString(dateText, 10 + offsetX, 85, 1);
+    snprintf(dateText, sizeof(dateText), "Datum: %s", frameState.dayAheadPrices.date);
+    gfx.drawString(dateText, 10 + offsetX, 85, 1);
 
     drawPriceChart(offsetX);
   } else {
     // Keine Daten verfügbar
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("Keine Day-Ahead Daten", Layout::PADDING_LARGE + offsetX, 110, 2);
-    tft.drawString("verfuegbar", Layout::PADDING_LARGE + offsetX, 130, 2);
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("Keine Day-Ahead Daten", Layout::PADDING_LARGE + offsetX, 110, 2);
+    gfx.drawString("verfuegbar", Layout::PADDING_LARGE + offsetX, 130, 2);
+
+    // MQTT Topic für Debug anzeigen
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Topic:", Layout::PADDING_LARGE + offsetX, 160, 1);
+    gfx.drawString("EnergyMarketPriceDayAhead", Layout::PADDING_LARGE + offsetX, 175, 1);
+  }
+}
+
+// Analytics und Chart ändern sich nur mit neuen Daten oder der Stundenmarkierung
+// (die Update-Zeile der Analytics liegt unterhalb des sichtbaren Bereichs)
+static uint32_t priceDetailBodySignature() {
+  return LayerSignature()
+    .add(frameState.dayAheadPrices.hasData ? 1 : 0)
+    .add((int)frameState.dayAheadPrices.lastUpdate)
+    .add((int)frameState.dayAheadPrices.lastAnalysis)
+    .add(chartCurrentHour())
+    .hash;
+}
+
+// Status-Info unten
+static void drawPriceDetailStatus() {
+  TFT_eSPI& gfx = canvas();
+  if (frameState.dayAheadPrices.lastUpdate == 0) return;
+
+  char ageText[32];
+  formatUpdateAge(ageText, sizeof(ageText), frameState.dayAheadPrices.lastUpdate);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString(ageText, Layout::PADDING_LARGE + frameState.antiBurnin.getOffsetX(), 220, 1);
+}
 
-    // MQTT Topic für Debug anzeigen
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Topic:", Layout::PADDING_LARGE + offsetX, 160, 1);
-    tft.drawString("EnergyMarketPriceDayAhead", Layout::PADDING_LARGE + offsetX, 175, 1);
-  }
+static uint32_t priceDetailStatusSignature() {
+  if (frameState.dayAheadPrices.lastUpdate == 0) return 0;
 
-  // Status-Info unten
-  tft.setTextColor(Colors::TEXT_LABEL);
-  if (dayAheadPrices.lastUpdate > 0) {
-    unsigned long age = (millis() - dayAheadPrices.lastUpdate) / 1000;
-    char ageText[32];
-    if (age < 60) {
-      snprintf(ageText, sizeof(ageText), "Update vor: %lus", age);
-    } else if (age < 3600) {
-      snprintf(ageText, sizeof(ageText), "Update vor: %lum", age / 60);
-    } else {
-      snprintf(ageText, sizeof(ageText), "Update vor: %luh", age / 3600);
-    }
-    tft.drawString(ageText, Layout::PADDING_LARGE + offsetX, 220, 1);
-  }
+  char ageText[32];
+  formatUpdateAge(ageText, sizeof(ageText), frameState.dayAheadPrices.lastUpdate);
+  return LayerSignature().add(ageText).hash;
+}
+
+static const ScreenLayer PRICE_DETAIL_LAYERS[] = {
+  {{0,   0, Layout::DISPLAY_WIDTH,  50}, drawPriceDetailChrome, nullptr, false},
+  {{0,  50, Layout::DISPLAY_WIDTH,  35}, drawPriceDetailValue,  priceDetailValueSignature, false},
+  {{0,  85, Layout::DISPLAY_WIDTH, 155}, drawPriceDetailBody,   priceDetailBodySignature, true},
+  {{0, 220, Layout::DISPLAY_WIDTH,   8}, drawPriceDetailStatus, priceDetailStatusSignature, false},
+};
+
+static const DetailScreen PRICE_DETAIL = {
+  PRICE_DETAIL_LAYERS, sizeof(PRICE_DETAIL_LAYERS) / sizeof(PRICE_DETAIL_LAYERS[0]), drawPriceDetailScreen
+};
 
+void drawPriceDetailScreen() {
+  Serial.println("Zeichne Preis-Detail-Screen...");
+  drawDetailLayers(PRICE_DETAIL);
   Serial.println("Preis-Detail-Screen vollständig gezeichnet");
 }
 
 void drawPriceAnalytics(int offsetX) {
+  TFT_eSPI& gfx = canvas();
   // Display comprehensive Day-Ahead analytics
   int yPos = 85;
   const int LINE_HEIGHT = 15;
   const int INDENT = Layout::PADDING_LARGE + offsetX;
 
   // Date and data quality
-  tft.setTextColor(Colors::TEXT_LABEL);
+  gfx.setTextColor(Colors::TEXT_LABEL);
   char headerText[64];
   snprintf(headerText, sizeof(headerText), "%s (Qualitaet: %d%%)",
-           dayAheadPrices.date, dayAheadPrices.dataQuality);
-  tft.drawString(headerText, INDENT, yPos, 1);
+           frameState.dayAheadPrices.date, frameState.dayAheadPrices.dataQuality);
+  gfx.drawString(headerText, INDENT, yPos, 1);
   yPos += LINE_HEIGHT;
 
   // Price statistics
-  tft.setTextColor(Colors::TEXT_MAIN);
+  gfx.setTextColor(Colors::TEXT_MAIN);
   char statsText[80];
   snprintf(statsText, sizeof(statsText), "Ø %.1fct  Min: %.1fct@%02d:00  Max: %.1fct@%02d:00",
-           dayAheadPrices.dailyAverage, dayAheadPrices.minPrice, dayAheadPrices.cheapestHour,
-           dayAheadPrices.maxPrice, dayAheadPrices.expensiveHour);
-  tft.drawString(statsText, INDENT, yPos, 1);
+           frameState.dayAheadPrices.dailyAverage, frameState.dayAheadPrices.minPrice, frameState.dayAheadPrices.cheapestHour,
+           frameState.dayAheadPrices.maxPrice, frameState.dayAheadPrices.expensiveHour);
+  gfx.drawString(statsText, INDENT, yPos, 1);
   yPos += LINE_HEIGHT + 5;
 
   // Trend and volatility
-  uint16_t trendColor = (dayAheadPrices.trend == TREND_RISING) ? Colors::STATUS_RED :
-                       (dayAheadPrices.trend == TREND_FALLING) ? Colors::STATUS_GREEN :
+  uint16_t trendColor = (frameState.dayAheadPrices.trend == TREND_RISING) ? Colors::STATUS_RED :
+                       (frameState.dayAheadPrices.trend == TREND_FALLING) ? Colors::STATUS_GREEN :
                        Colors::STATUS_BLUE;
-  const char* trendText = (dayAheadPrices.trend == TREND_RISING) ? "Steigend" :
-                         (dayAheadPrices.trend == TREND_FALLING) ? "Fallend" : "Stabil";
+  const char* trendText = (frameState.dayAheadPrices.trend == TREND_RISING) ? "Steigend" :
+                         (frameState.dayAheadPrices.trend == TREND_FALLING) ? "Fallend" : "Stabil";
 
-  tft.setTextColor(trendColor);
+  gfx.setTextColor(trendColor);
   char trendStr[60];
   snprintf(trendStr, sizeof(trendStr), "Trend: %s  Volatilität: %.1f%%",
-           trendText, dayAheadPrices.volatilityIndex);
-  tft.drawString(trendStr, INDENT, yPos, 1);
+           trendText, frameState.dayAheadPrices.volatilityIndex);
+  gfx.drawString(trendStr, INDENT, yPos, 1);
   yPos += LINE_HEIGHT + 8;
 
   // Optimization section header
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Optimale Zeiten für Hochverbrauch:", INDENT, yPos, 1);
+  gfx.setTextColor(Colors::TEXT_MAIN);
+  gfx.drawString("Optimale Zeiten für Hochverbrauch:", INDENT, yPos, 1);
   yPos += LINE_HEIGHT + 3;
 
   // Show optimal windows
-  tft.setTextColor(Colors::TEXT_LABEL);
+  gfx.setTextColor(Colors::TEXT_LABEL);
   int windowCount = 0;
   for (int i = 0; i < 3; i++) {
-    if (dayAheadPrices.optimalWindows[i].isAvailable) {
+    if (frameState.dayAheadPrices.optimalWindows[i].isAvailable) {
       windowCount++;
       char windowText[70];
       snprintf(windowText, sizeof(windowText), "%d. %02d:00-%02d:00  Ø %.1fct  (Sparen: %.1fct)",
                windowCount,
-               dayAheadPrices.optimalWindows[i].startHour,
-               dayAheadPrices.optimalWindows[i].endHour,
-               dayAheadPrices.optimalWindows[i].averagePrice,
-               dayAheadPrices.optimalWindows[i].savingsVsPeak);
-      tft.drawString(windowText, INDENT, yPos, 1);
+               frameState.dayAheadPrices.optimalWindows[i].startHour,
+               frameState.dayAheadPrices.optimalWindows[i].endHour,
+               frameState.dayAheadPrices.optimalWindows[i].averagePrice,
+               frameState.dayAheadPrices.optimalWindows[i].savingsVsPeak);
+      gfx.drawString(windowText, INDENT, yPos, 1);
       yPos += LINE_HEIGHT;
     }
   }
 
   if (windowCount == 0) {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("Keine optimalen Zeitfenster gefunden", INDENT, yPos, 1);
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("Keine optimalen Zeitfenster gefunden", INDENT, yPos, 1);
     yPos += LINE_HEIGHT;
   }
 
   yPos += 5;
 
   // Potential savings highlight
-  if (dayAheadPrices.potentialSavings > 0.5f) {
-    tft.setTextColor(Colors::STATUS_GREEN);
+  if (frameState.dayAheadPrices.potentialSavings > 0.5f) {
+    gfx.setTextColor(Colors::STATUS_GREEN);
     char savingsText[60];
     snprintf(savingsText, sizeof(savingsText), "Max. Einsparung: %.1fct/kWh",
-             dayAheadPrices.potentialSavings);
-    tft.drawString(savingsText, INDENT, yPos, 1);
+             frameState.dayAheadPrices.potentialSavings);
+    gfx.drawString(savingsText, INDENT, yPos, 1);
     yPos += LINE_HEIGHT;
   }
 
@@ -370,116 +1344,101 @@ void drawPriceAnalytics(int offsetX) {
   yPos += 50;
 
   // Update timestamp
-  if (dayAheadPrices.lastUpdate > 0) {
-    unsigned long age = (millis() - dayAheadPrices.lastUpdate) / 1000;
+  if (frameState.dayAheadPrices.lastUpdate > 0) {
     char ageText[32];
-    if (age < 60) {
-      snprintf(ageText, sizeof(ageText), "Update vor: %lus", age);
-    } else if (age < 3600) {
-      snprintf(ageText, sizeof(ageText), "Update vor: %lum", age / 60);
-    } else {
-      snprintf(ageText, sizeof(ageText), "Update vor: %luh", age / 3600);
-    }
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString(ageText, INDENT, yPos, 1);
+    formatUpdateAge(ageText, sizeof(ageText), frameState.dayAheadPrices.lastUpdate);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString(ageText, INDENT, yPos, 1);
   }
 }
 
 void drawSimplePriceChart(int x, int y, int width, int height) {
+  ProfileScope profile(PROFILE_SIMPLE_PRICE_CHART);
+  TFT_eSPI& gfx = canvas();
   // Draw a simple bar chart showing 24h price distribution with color coding
-  if (!dayAheadPrices.hasData) return;
+  if (!frameState.dayAheadPrices.hasData) return;
 
   const int BAR_WIDTH = width / 24;
   const int CHART_HEIGHT = height - 10; // Leave space for time labels
 
   // Draw chart border
-  tft.drawRect(x, y, width, height, Colors::BORDER_MAIN);
+  gfx.drawRect(x, y, width, height, Colors::BORDER_MAIN);
 
-  // Find valid price range for scaling
-  float minVal = dayAheadPrices.minPrice;
-  float maxVal = dayAheadPrices.maxPrice;
-  if (maxVal <= minVal) return;
+  // Scaling and colors (by price category) come from the shared chart model
+  const PriceChartModel& model = priceChartModel();
+  if (!model.analyticsRangeValid) return;
+  const int currentHour = chartCurrentHour();
 
   // Draw price bars for each hour
   for (int hour = 0; hour < 24; hour++) {
-    if (dayAheadPrices.prices[hour].isValid) {
+    if (model.valid[hour]) {
       int barX = x + (hour * BAR_WIDTH) + 1;
-      float price = dayAheadPrices.prices[hour].price;
-      int barHeight = (int)((price - minVal) / (maxVal - minVal) * CHART_HEIGHT);
-
-      // Color based on price category
-      uint16_t barColor;
-      switch (dayAheadPrices.prices[hour].category) {
-        case PRICE_VERY_CHEAP:   barColor = Colors::STATUS_GREEN; break;
-        case PRICE_CHEAP:        barColor = TFT_DARKGREEN; break;
-        case PRICE_MEDIUM:       barColor = Colors::STATUS_BLUE; break;
-        case PRICE_EXPENSIVE:    barColor = TFT_ORANGE; break;
-        case PRICE_VERY_EXPENSIVE: barColor = Colors::STATUS_RED; break;
-        default:                 barColor = Colors::TEXT_LABEL; break;
-      }
+      int barHeight = model.analyticsBarHeight(hour, CHART_HEIGHT);
 
       // Draw the bar
       if (barHeight > 0) {
-        tft.fillRect(barX, y + CHART_HEIGHT - barHeight, BAR_WIDTH - 1, barHeight, barColor);
+        gfx.fillRect(barX, y + CHART_HEIGHT - barHeight, BAR_WIDTH - 1, barHeight,
+                     model.color[CHART_VIEW_ANALYTICS][hour]);
       }
 
       // Mark current hour with a white outline
-      time_t now = time(nullptr);
-      struct tm* timeinfo = localtime(&now);
-      if (timeinfo && timeinfo->tm_hour == hour) {
-        tft.drawRect(barX - 1, y, BAR_WIDTH + 1, height, Colors::TEXT_MAIN);
+      if (hour == currentHour) {
+        gfx.drawRect(barX - 1, y, BAR_WIDTH + 1, height, Colors::TEXT_MAIN);
       }
     }
   }
 
   // Draw time labels every 6 hours
-  tft.setTextColor(Colors::TEXT_LABEL);
+  gfx.setTextColor(Colors::TEXT_LABEL);
   for (int h = 0; h < 24; h += 6) {
     int labelX = x + (h * BAR_WIDTH);
     char timeStr[4];
     snprintf(timeStr, sizeof(timeStr), "%02d", h);
-    tft.drawString(timeStr, labelX, y + height + 2, 1);
+    gfx.drawString(timeStr, labelX, y + height + 2, 1);
   }
 }
 
-void drawOekostromDetailScreen() {
-  Serial.println("Zeichne Ökostrom-Detail-Screen...");
-
-  tft.fillScreen(Colors::BG_MAIN);
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
+// ── Ökostrom-Detail-Screen ──
 
-  // Titel
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Oekostrom Details", 10 + offsetX, 10 + offsetY, 2);
+static void drawOekostromChrome() {
+  TFT_eSPI& gfx = canvas();
+  drawDetailHeader("Oekostrom Details", 10);
 
-  // Zurück-Button (oben rechts)
-  int backButtonX = 270 + offsetX;
-  int backButtonY = 10 + offsetY;
-  tft.drawRoundRect(backButtonX, backButtonY, 40, 20, 3, Colors::BORDER_MAIN);
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Zurueck", backButtonX + 3, backButtonY + 6, 1);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Aktueller Anteil:", 10 + frameState.antiBurnin.getOffsetX(), 40, 2);
+}
 
-  // Aktueller Ökostrom-Anteil (groß anzeigen)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Aktueller Anteil:", 10 + offsetX, 40, 2);
+// Aktueller Ökostrom-Anteil (groß anzeigen)
+static void drawOekostromValue() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
 
-  if (!sensors[0].isTimedOut) {
-    tft.setTextColor(Colors::TEXT_MAIN);
-    tft.drawString(sensors[0].formattedValue, 10 + offsetX, 65, 4);
+  if (!frameState.sensors[0].isTimedOut) {
+    gfx.setTextColor(Colors::TEXT_MAIN);
+    gfx.drawString(frameState.sensors[0].formattedValue, 10 + offsetX, 65, 4);
 
     // Status-Indikator entfernt - mehr Platz für Diagramm
 
   } else {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("--- %", 10 + offsetX, 65, 4);
-    tft.drawString("Keine Verbindung", 10 + offsetX, 105, 2);
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("--- %", 10 + offsetX, 65, 4);
+    gfx.drawString("Keine Verbindung", 10 + offsetX, 105, 2);
   }
+}
 
-  // Verbessertes Day-Ahead Preis-Diagramm (24h-Verlauf)
-  if (dayAheadPrices.hasData) {
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Day-Ahead Preise (24h):", 10 + offsetX, 110, 1);
+static uint32_t oekostromValueSignature() {
+  return LayerSignature().add(frameState.sensors[0].isTimedOut ? 1 : 0).add(frameState.sensors[0].formattedValue).hash;
+}
+
+// Verbessertes Day-Ahead Preis-Diagramm (24h-Verlauf)
+static void drawOekostromChart() {
+  ProfileScope profile(PROFILE_OEKOSTROM_CHART);
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+
+  if (frameState.dayAheadPrices.hasData) {
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Day-Ahead Preise (24h):", 10 + offsetX, 110, 1);
 
     const int chartX = 10 + offsetX;
     const int chartY = 130;
@@ -487,117 +1446,106 @@ void drawOekostromDetailScreen() {
     const int chartHeight = 50;
 
     // Rahmen für das Diagramm
-    tft.drawRect(chartX, chartY, chartWidth, chartHeight, Colors::BORDER_MAIN);
-
-    // Finde Min/Max für Skalierung (alle 24 Stunden)
-    float minPrice = 999.0f;
-    float maxPrice = -999.0f;
-    int validCount = 0;
-
-    for (int i = 0; i < 24; i++) {
-      if (dayAheadPrices.prices[i].isValid) {
-        minPrice = min(minPrice, dayAheadPrices.prices[i].price);
-        maxPrice = max(maxPrice, dayAheadPrices.prices[i].price);
-        validCount++;
-      }
-    }
+    gfx.drawRect(chartX, chartY, chartWidth, chartHeight, Colors::BORDER_MAIN);
 
-    if (validCount > 0) {
-      float priceRange = maxPrice - minPrice;
-      // Entferne Fix für zu kleine Werte - das führte zu Preissprüngen
+    // Min/Max/Durchschnitt und Farben (Quartile der Spanne) aus dem Chart-Modell
+    const PriceChartModel& model = priceChartModel();
 
+    if (model.validCount > 0) {
       // Zeichne Preisverlauf als vertikale Balken
       const int barWidth = chartWidth / 24;
 
       for (int i = 0; i < 24; i++) {
-        if (dayAheadPrices.prices[i].isValid) {
-          float price = dayAheadPrices.prices[i].price;
-
+        if (model.valid[i]) {
           // Höhe des Balkens basierend auf Preis
-          int barHeight = (int)((price - minPrice) / priceRange * (chartHeight - 4));
-          barHeight = max(2, barHeight);
-
-          // Farbe basierend auf Preis (relativ zu Min/Max)
-          uint16_t barColor = Colors::STATUS_GREEN;
-          if (price > (minPrice + priceRange * 0.75f)) {
-            barColor = Colors::STATUS_RED;      // Teuer
-          } else if (price > (minPrice + priceRange * 0.5f)) {
-            barColor = Colors::STATUS_ORANGE;   // Mittel
-          } else if (price > (minPrice + priceRange * 0.25f)) {
-            barColor = Colors::STATUS_YELLOW;   // Günstig
-          }
-          // else: Sehr günstig = grün
+          int barHeight = max(2, model.barHeight(i, chartHeight - 4));
 
           int barX = chartX + 2 + i * barWidth;
           int barY = chartY + chartHeight - 2 - barHeight;
 
-          tft.fillRect(barX, barY, barWidth - 1, barHeight, barColor);
+          gfx.fillRect(barX, barY, barWidth - 1, barHeight, model.color[CHART_VIEW_OEKOSTROM][i]);
 
           // Stundenmarkierung alle 4 Stunden
           if (i % 4 == 0) {
-            tft.setTextColor(Colors::TEXT_LABEL);
+            gfx.setTextColor(Colors::TEXT_LABEL);
             char hourStr[4];
             snprintf(hourStr, sizeof(hourStr), "%02d", i);
-            tft.drawString(hourStr, barX - 2, chartY + chartHeight + 2, 1);
+            gfx.drawString(hourStr, barX - 2, chartY + chartHeight + 2, 1);
           }
         }
       }
 
       // Durchschnittslinie
-      float avgPrice = 0.0f;
-      for (int i = 0; i < 24; i++) {
-        if (dayAheadPrices.prices[i].isValid) {
-          avgPrice += dayAheadPrices.prices[i].price;
-        }
-      }
-      avgPrice /= validCount;
-
-      int avgY = chartY + chartHeight - 2 - (int)((avgPrice - minPrice) / priceRange * (chartHeight - 4));
-      tft.drawLine(chartX + 2, avgY, chartX + chartWidth - 2, avgY, Colors::TEXT_MAIN);
+      int avgY = chartY + chartHeight - 2 - model.averageOffset(chartHeight - 4);
+      gfx.drawLine(chartX + 2, avgY, chartX + chartWidth - 2, avgY, Colors::TEXT_MAIN);
 
       // Preisinformationen
       char priceInfo[64];
       snprintf(priceInfo, sizeof(priceInfo), "Min: %.1fct  Ø: %.1fct  Max: %.1fct",
-               minPrice, avgPrice, maxPrice);
-      tft.setTextColor(Colors::TEXT_LABEL);
-      tft.drawString(priceInfo, 10 + offsetX, 188, 1);
+               model.minPrice, model.avgPrice, model.maxPrice);
+      gfx.setTextColor(Colors::TEXT_LABEL);
+      gfx.drawString(priceInfo, 10 + offsetX, 188, 1);
 
       // Aktuelle Stunde hervorheben (wenn Zeitdaten verfügbar)
-      if (systemStatus.timeValid) {
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo)) {
-          int currentHour = timeinfo.tm_hour;
-          if (currentHour < 24 && dayAheadPrices.prices[currentHour].isValid) {
-            int currentX = chartX + 2 + currentHour * barWidth;
-            tft.drawRect(currentX - 1, chartY + 1, barWidth + 1, chartHeight - 2, Colors::TEXT_MAIN);
-
-            // Aktueller Preis anzeigen
-            char currentPriceStr[16];
-            snprintf(currentPriceStr, sizeof(currentPriceStr), "Jetzt: %.1fct",
-                     dayAheadPrices.prices[currentHour].price);
-            tft.setTextColor(Colors::TEXT_MAIN);
-            tft.drawString(currentPriceStr, 10 + offsetX, 200, 1);
-          }
-        }
+      int currentHour = chartCurrentHour();
+      if (currentHour >= 0 && model.valid[currentHour]) {
+        int currentX = chartX + 2 + currentHour * barWidth;
+        gfx.drawRect(currentX - 1, chartY + 1, barWidth + 1, chartHeight - 2, Colors::TEXT_MAIN);
+
+        // Aktueller Preis anzeigen
+        char currentPriceStr[16];
+        snprintf(currentPriceStr, sizeof(currentPriceStr), "Jetzt: %.1fct",
+                 frameState.dayAheadPrices.prices[currentHour].price);
+        gfx.setTextColor(Colors::TEXT_MAIN);
+        gfx.drawString(currentPriceStr, 10 + offsetX, 200, 1);
       }
 
     } else {
-      tft.setTextColor(Colors::TEXT_TIMEOUT);
-      tft.drawString("Keine gültigen Preisdaten", chartX + 10, chartY + 20, 1);
+      gfx.setTextColor(Colors::TEXT_TIMEOUT);
+      gfx.drawString("Keine gültigen Preisdaten", chartX + 10, chartY + 20, 1);
     }
   } else {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("Keine Day-Ahead Daten verfuegbar", 10 + offsetX, 130, 1);
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("Keine Day-Ahead Daten verfuegbar", 10 + offsetX, 130, 1);
   }
+}
+
+static uint32_t oekostromChartSignature() {
+  LayerSignature signature;
+  signature.add(frameState.dayAheadPrices.hasData ? 1 : 0).add((int)frameState.dayAheadPrices.lastUpdate);
+
+  // Hervorhebung der aktuellen Stunde
+  return signature.add(chartCurrentHour()).hash;
+}
+
+// System-Info (Position angepasst für neues Chart)
+// MQTT Topic Info entfernt um Platz zu schaffen
+static void drawOekostromFooter() {
+  TFT_eSPI& gfx = canvas();
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("home/PV/Share_renewable", 85 + frameState.antiBurnin.getOffsetX(), 215, 1);
+}
+
+static const ScreenLayer OEKOSTROM_LAYERS[] = {
+  {{0,   0, Layout::DISPLAY_WIDTH, 56}, drawOekostromChrome, nullptr, false},
+  {{0,  65, Layout::DISPLAY_WIDTH, 56}, drawOekostromValue,  oekostromValueSignature, false},
+  {{0, 110, Layout::DISPLAY_WIDTH, 98}, drawOekostromChart,  oekostromChartSignature, true},
+  {{0, 215, Layout::DISPLAY_WIDTH,  8}, drawOekostromFooter, nullptr, false},
+};
 
-  // System-Info (Position angepasst für neues Chart)
-  // MQTT Topic Info entfernt um Platz zu schaffen
-  tft.drawString("home/PV/Share_renewable", 85 + offsetX, 215, 1);
+static const DetailScreen OEKOSTROM_DETAIL = {
+  OEKOSTROM_LAYERS, sizeof(OEKOSTROM_LAYERS) / sizeof(OEKOSTROM_LAYERS[0]), drawOekostromDetailScreen
+};
 
+void drawOekostromDetailScreen() {
+  Serial.println("Zeichne Ökostrom-Detail-Screen...");
+  drawDetailLayers(OEKOSTROM_DETAIL);
   Serial.println("Ökostrom-Detail-Screen vollständig gezeichnet");
 }
 
 void drawPriceChart(int offsetX) {
+  ProfileScope profile(PROFILE_PRICE_CHART);
+  TFT_eSPI& gfx = canvas();
   // Einfaches Balkendiagramm für 24h Preise
   const int chartX = 10 + offsetX;
   const int chartY = 85;
@@ -606,25 +1554,15 @@ void drawPriceChart(int offsetX) {
   const int barWidth = chartWidth / Layout::CHART_HOURS;
 
   // Chart-Rahmen
-  tft.drawRect(chartX, chartY, chartWidth, chartHeight, Colors::BORDER_MAIN);
-
-  // Finde Min/Max Preise für Skalierung
-  float minPrice = 999.0f;
-  float maxPrice = -999.0f;
-  int validPrices = 0;
+  gfx.drawRect(chartX, chartY, chartWidth, chartHeight, Colors::BORDER_MAIN);
 
-  for (int i = 0; i < Layout::CHART_HOURS; i++) {
-    if (dayAheadPrices.prices[i].isValid) {
-      minPrice = min(minPrice, dayAheadPrices.prices[i].price);
-      maxPrice = max(maxPrice, dayAheadPrices.prices[i].price);
-      validPrices++;
-    }
-  }
+  // Skalierung und Farben (relativ zur Spannenmitte) aus dem Chart-Modell
+  const PriceChartModel& model = priceChartModel();
 
-  if (validPrices == 0) {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("Keine gueltigen", chartX + 10, chartY + 20, 1);
-    tft.drawString("Preisdaten", chartX + 10, chartY + 35, 1);
+  if (model.validCount == 0) {
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("Keine gueltigen", chartX + 10, chartY + 20, 1);
+    gfx.drawString("Preisdaten", chartX + 10, chartY + 35, 1);
     return;
   }
 
@@ -632,45 +1570,28 @@ void drawPriceChart(int offsetX) {
 
   // Zeichne Balken für jede Stunde
   for (int i = 0; i < Layout::CHART_HOURS; i++) {
-    if (dayAheadPrices.prices[i].isValid) {
-      float price = dayAheadPrices.prices[i].price;
-
+    if (model.valid[i]) {
       // Skalierung des Balkens
-      float priceRange = maxPrice - minPrice;
-      // Entferne Fix für zu kleine Werte - das führte zu Preissprüngen
-
-      int barHeight = (priceRange > 0) ? (int)((price - minPrice) / priceRange * (chartHeight - 4)) : 1;
-      barHeight = max(1, barHeight);  // Mindesthöhe
-
-      // Farbe basierend auf Preis (relativ zu Durchschnitt)
-      uint16_t barColor;
-      float avgPrice = (minPrice + maxPrice) / 2.0f;
-      if (price < avgPrice * 0.8f) {
-        barColor = Colors::STATUS_GREEN;  // Günstig
-      } else if (price > avgPrice * 1.2f) {
-        barColor = Colors::STATUS_RED;    // Teuer
-      } else {
-        barColor = Colors::STATUS_YELLOW; // Mittel
-      }
+      int barHeight = max(1, model.barHeight(i, chartHeight - 4));  // Mindesthöhe
 
       // Zeichne Balken (von unten nach oben)
       int barX = chartX + 2 + i * barWidth;
       int barY = chartY + chartHeight - 2 - barHeight;
 
-      tft.fillRect(barX, barY, barWidth - 1, barHeight, barColor);
+      gfx.fillRect(barX, barY, barWidth - 1, barHeight, model.color[CHART_VIEW_LEGACY][i]);
 
       // Stunden-Label (jede 4. Stunde)
       if (i % Layout::CHART_HOUR_INTERVAL == 0) {
-        tft.setTextColor(Colors::TEXT_LABEL);
+        gfx.setTextColor(Colors::TEXT_LABEL);
         char hourStr[4];
         snprintf(hourStr, sizeof(hourStr), "%d", i);
-        tft.drawString(hourStr, barX, chartY + chartHeight + 2, 1);
+        gfx.drawString(hourStr, barX, chartY + chartHeight + 2, 1);
       }
     }
   }
 
   Serial.printf("Preis-Chart gezeichnet: %d gültige Preise (%.2f - %.2f ct)\n",
-                validPrices, minPrice, maxPrice);
+                model.validCount, model.minPrice, model.maxPrice);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -679,13 +1600,13 @@ void drawPriceChart(int offsetX) {
 
 bool isStockDisplayTime() {
   // Prüft ob die aktuelle Zeit zwischen 8:00 und 22:00 liegt
-  if (!systemStatus.timeValid) return true; // Fallback: zeige an wenn Zeit nicht verfügbar
+  if (!frameState.systemStatus.timeValid) return true; // Fallback: zeige an wenn Zeit nicht verfügbar
   
   // Sichere Parse der aktuellen Uhrzeit (Format: "HH:MM:SS")
-  if (strlen(systemStatus.currentTime) < 5) return true; // Fallback bei ungültiger Zeit
+  if (strlen(frameState.systemStatus.currentTime) < 5) return true; // Fallback bei ungültiger Zeit
   
   int hour = 0, minute = 0;
-  int parsed = sscanf(systemStatus.currentTime, "%d:%d", &hour, &minute);
+  int parsed = sscanf(frameState.systemStatus.currentTime, "%d:%d", &hour, &minute);
   
   if (parsed >= 1 && hour >= 0 && hour <= 23) {
     // Zwischen 8:00 und 21:59 anzeigen (22:00 = nicht mehr anzeigen)
@@ -700,10 +1621,10 @@ void drawCombinedSensorBox(int index1, int index2, int x, int y, int width, int
   if (index1 < 0 || index1 >= System::SENSOR_COUNT || 
       index2 < 0 || index2 >= System::SENSOR_COUNT) return;
   
-  const SensorData& sensor1 = sensors[index1];
-  const SensorData& sensor2 = sensors[index2];
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
+  const SensorData& sensor1 = frameState.sensors[index1];
+  const SensorData& sensor2 = frameState.sensors[index2];
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  int offsetY = frameState.antiBurnin.getOffsetY();
 
   int boxX = x + offsetX;
   int boxY = y + offsetY;
@@ -766,34 +1687,29 @@ void drawCombinedSensorBox(int index1, int index2, int x, int y, int width, int
                index2, sensor2.label, sensor2.formattedValue);
 }
 
-void drawSensorBox(int index) {
-  if (index < 0 || index >= System::SENSOR_COUNT) return;
-  
+// Aktien-Box (Index 2) nur zwischen 8:00-22:00 anzeigen
+static bool isSensorBoxClosed(int index) {
+  return index == 2 && !isStockDisplayTime();
+}
+
+// Unveränderliche Teile einer Sensor-Box (Fläche, Rahmen, Label) an
+// (boxX, boxY) auf das aktuelle Zeichenziel. Hängt nur vom Timeout-Zustand ab.
+static void renderSensorChrome(int index, int boxX, int boxY) {
+  TFT_eSPI& gfx = canvas();
+  const SensorData& sensor = frameState.sensors[index];
+
   // Spezielle Behandlung für Aktien-Box (Index 2): Nur zwischen 8:00-22:00 anzeigen
-  if (index == 2 && !isStockDisplayTime()) {
+  if (isSensorBoxClosed(index)) {
     // Aktien-Box ausblenden: Bereich löschen
-    const SensorData& sensor = sensors[index];
-    int offsetX = antiBurnin.getOffsetX();
-    int offsetY = antiBurnin.getOffsetY();
-    int boxX = sensor.layout.x + offsetX;
-    int boxY = sensor.layout.y + offsetY;
-    
-    tft.fillRect(boxX, boxY, sensor.layout.w, sensor.layout.h, Colors::BG_MAIN);
+    gfx.fillRect(boxX, boxY, sensor.layout.w, sensor.layout.h, Colors::BG_MAIN);
     
     // Alternativ: Zeige "Börsenschluss" an
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Boerse", boxX + Layout::PADDING_SMALL, boxY + Layout::PADDING_SMALL, 1);
-    tft.drawString("geschl.", boxX + Layout::PADDING_SMALL, boxY + 15, 1);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Boerse", boxX + Layout::PADDING_SMALL, boxY + Layout::PADDING_SMALL, 1);
+    gfx.drawString("geschl.", boxX + Layout::PADDING_SMALL, boxY + 15, 1);
     return;
   }
   
-  const SensorData& sensor = sensors[index];
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
-
-  int boxX = sensor.layout.x + offsetX;
-  int boxY = sensor.layout.y + offsetY;
-  
   // Spezielle Behandlung für intern berechnete Sensoren (Index 4 und 8)
   uint16_t bgColor;
   if (index == 4 || index == 8) {
@@ -805,29 +1721,35 @@ void drawSensorBox(int index) {
   }
   
   // Box mit abgerundeten Ecken
-  tft.fillRoundRect(boxX, boxY, sensor.layout.w, sensor.layout.h, 
+  gfx.fillRoundRect(boxX, boxY, sensor.layout.w, sensor.layout.h, 
                    Layout::SENSOR_BOX_RADIUS, bgColor);
-  tft.drawRoundRect(boxX, boxY, sensor.layout.w, sensor.layout.h, 
+  gfx.drawRoundRect(boxX, boxY, sensor.layout.w, sensor.layout.h, 
                    Layout::SENSOR_BOX_RADIUS, Colors::BORDER_MAIN);
   
   // Label zeichnen
   uint16_t labelColor = sensor.isTimedOut ? Colors::TEXT_TIMEOUT : Colors::TEXT_LABEL;
-  tft.setTextColor(labelColor);
-  tft.drawString(sensor.label, boxX + Layout::PADDING_SMALL, boxY + Layout::PADDING_SMALL, 1);
-  
+  gfx.setTextColor(labelColor);
+  gfx.drawString(sensor.label, boxX + Layout::PADDING_SMALL, boxY + Layout::PADDING_SMALL, 1);
+}
+
+// Dynamische Teile einer Sensor-Box (Wert, Trend, Balken, Ampel) über der Chrome
+static void renderSensorContent(int index, int boxX, int boxY) {
+  TFT_eSPI& gfx = canvas();
+  const SensorData& sensor = frameState.sensors[index];
+  if (isSensorBoxClosed(index)) return;
+
   // Wert anzeigen (ohne Trend-Farben)
   if (sensor.isTimedOut) {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("---", boxX + Layout::PADDING_SMALL, boxY + 15, 2);
+    drawCachedString(gfx, "---", boxX + Layout::PADDING_SMALL, boxY + 15, 2, Colors::TEXT_TIMEOUT);
   } else {
     if (index == 2) {
       // Aktien-Box: Wert + Prozentänderung anzeigen
-      tft.setTextColor(Colors::TEXT_MAIN);
-      tft.drawString(sensor.formattedValue, boxX + Layout::PADDING_SMALL, boxY + 12, 2); // 3px höher
+      drawCachedString(gfx, sensor.formattedValue, boxX + Layout::PADDING_SMALL, boxY + 12, 2,
+                       Colors::TEXT_MAIN); // 3px höher
       
       // Prozentänderung berechnen und anzeigen
-      if (stockPreviousClose > 0.01f) {
-        float percentChange = ((sensor.value - stockPreviousClose) / stockPreviousClose) * 100.0f;
+      if (frameState.stockPreviousClose > 0.01f) {
+        float percentChange = ((sensor.value - frameState.stockPreviousClose) / frameState.stockPreviousClose) * 100.0f;
         
         // Farbe basierend auf Änderung
         uint16_t percentColor = Colors::TEXT_LABEL; // Standard grau
@@ -837,7 +1759,7 @@ void drawSensorBox(int index) {
           percentColor = Colors::STATUS_RED;
         }
         
-        tft.setTextColor(percentColor);
+        gfx.setTextColor(percentColor);
         
         // Formatierung für Platz sparen: ohne "%" falls zu eng
         char percentText[16];
@@ -848,17 +1770,17 @@ void drawSensorBox(int index) {
         }
         
         // Kleine Schrift für Prozentänderung unter dem Preis
-        tft.drawString(percentText, boxX + Layout::PADDING_SMALL, boxY + 28, 1);
+        gfx.drawString(percentText, boxX + Layout::PADDING_SMALL, boxY + 28, 1);
       }
     } else if (index == 4) {
       // Verbrauch-Box: Zeige Gesamtverbrauch höher positioniert (wie bei Aktien)
-      tft.setTextColor(Colors::TEXT_MAIN);
       char totalText[16];
-      snprintf(totalText, sizeof(totalText), "%.1fkW", loadPower);
-      tft.drawString(totalText, boxX + Layout::PADDING_SMALL, boxY + 12, 2); // 3px höher wie bei Aktien
+      snprintf(totalText, sizeof(totalText), "%.1fkW", frameState.loadPower);
+      drawCachedString(gfx, totalText, boxX + Layout::PADDING_SMALL, boxY + 12, 2,
+                       Colors::TEXT_MAIN); // 3px höher wie bei Aktien
     } else {
-      tft.setTextColor(Colors::TEXT_MAIN);  // Immer weiß
-      tft.drawString(sensor.formattedValue, boxX + Layout::PADDING_SMALL, boxY + 15, 2);
+      drawCachedString(gfx, sensor.formattedValue, boxX + Layout::PADDING_SMALL, boxY + 15, 2,
+                       Colors::TEXT_MAIN);  // Immer weiß
     }
     
     // Trend-Pfeil zeichnen (nur für spezifische Sensoren)
@@ -909,6 +1831,193 @@ void drawSensorBox(int index) {
   }
 }
 
+// Vollständige Sensor-Box ohne Chrome-Layer
+static void renderSensorBox(int index, int boxX, int boxY) {
+  renderSensorChrome(index, boxX, boxY);
+  renderSensorContent(index, boxX, boxY);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              SEGMENT-BALKEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+SegmentBarStats segmentBarStats;
+
+struct SegmentBar {
+  int16_t x = 0, y = 0, width = 0, height = 0;   // Zeichenziel-Koordinaten
+  int16_t frameWidth = 0;             // Rahmen über die ersten frameWidth Spalten
+  uint8_t count = 0;
+  int16_t starts[SegmentBarConfig::MAX_SEGMENTS];  // relativ zu x
+  int16_t widths[SegmentBarConfig::MAX_SEGMENTS];
+  uint16_t colors[SegmentBarConfig::MAX_SEGMENTS];
+
+  bool sameGeometry(const SegmentBar& other) const {
+    return x == other.x && y == other.y && width == other.width && height == other.height;
+  }
+};
+
+// Zuletzt gezeichneter Segment-Balken (von drawSensorBox ausgewertet)
+static SegmentBar drawnBar;
+static bool barDrawn = false;
+
+static void fillBarSegment(TFT_eSPI& gfx, SegmentBar& bar, int x, int width, uint16_t color) {
+  gfx.fillRect(x, bar.y, width, bar.height, color);
+  if (bar.count < SegmentBarConfig::MAX_SEGMENTS) {
+    bar.starts[bar.count] = x - bar.x;
+    bar.widths[bar.count] = width;
+    bar.colors[bar.count] = color;
+    bar.count++;
+  }
+}
+
+static void finishSegmentBar(TFT_eSPI& gfx, SegmentBar& bar, int frameWidth) {
+  gfx.drawRect(bar.x, bar.y, frameWidth, bar.height, Colors::BORDER_PROGRESS);
+  bar.frameWidth = frameWidth;
+  if (canvasHasPixels()) {
+    drawnBar = bar;
+    barDrawn = true;
+  }
+}
+
+// Inhalt einer Balkenspalte: Füllfarbe und Rahmen (0 keiner, 1 oben/unten, 2 Kante)
+static uint32_t barColumn(const SegmentBar& bar, int column) {
+  uint16_t color = Colors::BG_MAIN;
+  for (int i = 0; i < bar.count; i++) {
+    if (column >= bar.starts[i] && column < bar.starts[i] + bar.widths[i]) color = bar.colors[i];
+  }
+  uint32_t frame = 0;
+  if (column < bar.frameWidth) frame = (column == 0 || column == bar.frameWidth - 1) ? 2 : 1;
+  return ((uint32_t)color << 2) | frame;
+}
+
+// Spaltenläufe (Zeichenziel-Koordinaten), deren Inhalt sich zwischen zwei
+// Balken gleicher Lage unterscheidet. -1 wenn es mehr als 'maxRuns' sind.
+static int changedBarColumns(const SegmentBar& before, const SegmentBar& after, DirtyRect* runs, int maxRuns) {
+  int count = 0;
+  int runStart = -1;
+  for (int column = 0; column <= after.width; column++) {
+    bool changed = column < after.width && barColumn(before, column) != barColumn(after, column);
+    if (changed && runStart < 0) runStart = column;
+    if (!changed && runStart >= 0) {
+      if (count == maxRuns) return -1;
+      runs[count++] = DirtyRect(after.x + runStart, after.y, column - runStart, after.height);
+      runStart = -1;
+    }
+  }
+  return count;
+}
+
+// Stand der Box auf dem Panel nach dem letzten Push mit Segment-Balken;
+// ob das Panel ihn noch zeigt, weiß der Panel-Wächter (Slot = Box-Index)
+struct BarBoxState {
+  uint32_t outsideHash = 0;           // Sprite ohne Balkenfläche
+  SegmentBar bar;
+};
+
+static BarBoxState barBoxStates[System::SENSOR_COUNT];
+
+static uint32_t hashOutsideBar(TFT_eSprite& sprite, const SegmentBar& bar) {
+  LayerSignature signature;
+  const uint16_t* pixels = (const uint16_t*)sprite.getPointer();
+  int width = sprite.width();
+  for (int row = 0; row < sprite.height(); row++) {
+    const uint16_t* line = pixels + row * width;
+    if (row < bar.y || row >= bar.y + bar.height) {
+      signature.add(line, width * sizeof(uint16_t));
+      continue;
+    }
+    int left = constrain((int)bar.x, 0, width);
+    int right = constrain(bar.x + bar.width, left, width);
+    signature.add(line, left * sizeof(uint16_t));
+    signature.add(line + right, (width - right) * sizeof(uint16_t));
+  }
+  return signature.hash;
+}
+
+// Überträgt einen fertigen Box-Sprite mit Segment-Balken: nur die geänderten
+// Balkenspalten, wenn der Rest der Box unverändert auf dem Panel steht.
+// false wenn die Box keinen Segment-Balken hat (Aufrufer überträgt normal).
+static bool pushSensorBoxWithBar(int index, TFT_eSprite& sprite, int boxX, int boxY) {
+  BarBoxState& state = barBoxStates[index];
+  if (!SegmentBarConfig::ENABLED || !barDrawn) return false;
+
+  DirtyRect area(boxX + tft.getViewportX(), boxY + tft.getViewportY(), sprite.width(), sprite.height());
+  uint32_t outsideHash = hashOutsideBar(sprite, drawnBar);
+  bool fullyVisible = tft.visibleArea(boxX, boxY, sprite.width(), sprite.height()).contains(area);
+
+  DirtyRect runs[SegmentBarConfig::MAX_RUNS];
+  int runCount = -1;
+  if (fullyVisible && isPanelAreaIntact(index, area) &&
+      state.outsideHash == outsideHash && state.bar.sameGeometry(drawnBar)) {
+    runCount = changedBarColumns(state.bar, drawnBar, runs, SegmentBarConfig::MAX_RUNS);
+  }
+
+  if (runCount == 0) {
+    segmentBarStats.unchanged++;
+    return true;
+  }
+  if (runCount > 0) {
+    // Spaltenläufe in absolute Koordinaten (Sprite-Ursprung = Box)
+    long pixels = 0;
+    for (int i = 0; i < runCount; i++) {
+      runs[i].x += area.x;
+      runs[i].y += area.y;
+      pixels += runs[i].area();
+    }
+    pushSpritePartsToPanel(sprite, boxX, boxY, runs, runCount);
+    segmentBarStats.deltaPushes++;
+    segmentBarStats.deltaPixels += pixels;
+  } else {
+    pushSpriteToPanel(sprite, boxX, boxY);
+    segmentBarStats.fullPushes++;
+  }
+
+  // Erst nach dem eigenen Push anmelden (der Push selbst gilt als Schreibzugriff)
+  watchPanelArea(index, fullyVisible ? area : DirtyRect());
+  state.outsideHash = outsideHash;
+  state.bar = drawnBar;
+  return true;
+}
+
+void drawSensorBox(int index) {
+  ProfileScope profile(PROFILE_SENSOR_BOX);
+  if (index < 0 || index >= System::SENSOR_COUNT) return;
+  
+  const SensorData& sensor = frameState.sensors[index];
+  int boxX = sensor.layout.x + frameState.antiBurnin.getOffsetX();
+  int boxY = sensor.layout.y + frameState.antiBurnin.getOffsetY();
+  
+  // Box off-screen im Sprite aufbauen und in einem SPI-Burst übertragen
+  // (kein Flackern durch Hintergrund-Löschen vor dem Neuzeichnen)
+  TFT_eSprite* sprite = acquireSensorBoxSprite(sensor.layout.w, sensor.layout.h);
+  if (sprite != nullptr) {
+    const CachedLayer* chrome = currentHomeChrome();
+    barDrawn = false;
+    {
+      RasterScope raster;   // Panel während des Aufbaus frei
+      CanvasScope scope(*sprite);
+      if (chrome != nullptr) {
+        // Fläche, Rahmen und Label aus dem Chrome-Layer übernehmen
+        chrome->copyTo(*sprite, boxX, boxY, DirtyRect(boxX, boxY, sensor.layout.w, sensor.layout.h));
+        cachedLayerStats.composedBoxes++;
+      } else {
+        sprite->fillSprite(Colors::BG_MAIN);  // Ecken außerhalb der Rundung
+        renderSensorChrome(index, 0, 0);
+      }
+      renderSensorContent(index, 0, 0);
+    }
+    if (!pushSensorBoxWithBar(index, *sprite, boxX, boxY)) {
+      pushSpriteToPanel(*sprite, boxX, boxY);
+    }
+    spriteRenderStats.spritePushes++;
+  } else {
+    // Fallback ohne Sprite-Speicher: direkt auf das Panel zeichnen
+    finishPanelDMA();
+    renderSensorBox(index, boxX, boxY);
+    spriteRenderStats.directFallbacks++;
+  }
+}
+
 uint16_t getTrendColor(SensorData::TrendDirection trend, int index) {
   switch (index) {
     case 1: // Strompreis: niedrigerer Preis = grün
@@ -919,9 +2028,9 @@ uint16_t getTrendColor(SensorData::TrendDirection trend, int index) {
       return Colors::TEXT_MAIN;
     
     case 2: // Aktienkurs: Vergleich mit stockPreviousClose
-      if (stockPreviousClose <= 0.0f) return Colors::TEXT_MAIN;
-      return (sensors[index].value > stockPreviousClose) ? Colors::TREND_UP : 
-             (sensors[index].value < stockPreviousClose) ? Colors::TREND_DOWN : Colors::TEXT_MAIN;
+      if (frameState.stockPreviousClose <= 0.0f) return Colors::TEXT_MAIN;
+      return (frameState.sensors[index].value > frameState.stockPreviousClose) ? Colors::TREND_UP : 
+             (frameState.sensors[index].value < frameState.stockPreviousClose) ? Colors::TREND_DOWN : Colors::TEXT_MAIN;
     
     default: // Standard: höhere Werte = grün
       return (trend == SensorData::UP) ? Colors::TREND_UP : 
@@ -930,23 +2039,26 @@ uint16_t getTrendColor(SensorData::TrendDirection trend, int index) {
 }
 
 void drawSystemInfo() {
-  int infoX = Layout::SYSTEM_INFO_X + antiBurnin.getOffsetX();
-  int infoY = Layout::SYSTEM_INFO_Y;
+  ProfileScope profile(PROFILE_SYSTEM_INFO);
+  TFT_eSPI& gfx = canvas();
+  const WidgetLayout& area = WIDGETS[WIDGET_SYSTEM_INFO];
+  int infoX = area.x + frameState.antiBurnin.getOffsetX();
+  int infoY = area.y;
   
-  // Erweiterten Bereich löschen
-  tft.fillRect(infoX, infoY, Layout::SYSTEM_INFO_WIDTH, Layout::SYSTEM_INFO_HEIGHT + Layout::SYSTEM_INFO_EXTENDED_HEIGHT, Colors::BG_MAIN);
+  // Bereich löschen
+  gfx.fillRect(infoX, infoY, area.w, area.h, Colors::BG_MAIN);
   
   // RAM-Status - einheitlich grau wie Uptime/LDR
   char memText[24];
-  if (systemStatus.freeHeap >= 1024 * 1024) {
-    snprintf(memText, sizeof(memText), "RAM:%luMB", systemStatus.freeHeap / (1024 * 1024));
-  } else if (systemStatus.freeHeap >= 1024) {
-    snprintf(memText, sizeof(memText), "RAM:%luKB", systemStatus.freeHeap / 1024);
+  if (frameState.systemStatus.freeHeap >= 1024 * 1024) {
+    snprintf(memText, sizeof(memText), "RAM:%luMB", frameState.systemStatus.freeHeap / (1024 * 1024));
+  } else if (frameState.systemStatus.freeHeap >= 1024) {
+    snprintf(memText, sizeof(memText), "RAM:%luKB", frameState.systemStatus.freeHeap / 1024);
   } else {
-    snprintf(memText, sizeof(memText), "RAM:%luB", systemStatus.freeHeap);
+    snprintf(memText, sizeof(memText), "RAM:%luB", frameState.systemStatus.freeHeap);
   }
 
-  if (systemStatus.lowMemoryWarning) {
+  if (frameState.systemStatus.lowMemoryWarning) {
     size_t len = strlen(memText);
     if (len < sizeof(memText) - 1) {
       memText[len] = '!';
@@ -954,49 +2066,52 @@ void drawSystemInfo() {
     }
   }
   
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString(memText, infoX, infoY, 1);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString(memText, infoX, infoY, 1);
   
   // CPU-Last - einheitlich grau wie Uptime/LDR
-  tft.setTextColor(Colors::TEXT_LABEL);
+  gfx.setTextColor(Colors::TEXT_LABEL);
   char cpuText[16];
-  snprintf(cpuText, sizeof(cpuText), "CPU:%.0f%%", systemStatus.cpuUsageSmoothed);
-  tft.drawString(cpuText, infoX, infoY + Layout::LINE_SPACING, 1);
+  snprintf(cpuText, sizeof(cpuText), "CPU:%.0f%%", frameState.systemStatus.cpuUsageSmoothed);
+  gfx.drawString(cpuText, infoX, infoY + Layout::LINE_SPACING, 1);
   
   // Uptime und LDR nebeneinander (platzsparend)
   char uptimeText[16];
-  if (systemStatus.uptime < 3600) {
-    snprintf(uptimeText, sizeof(uptimeText), "UP:%lum", systemStatus.uptime / 60);
-  } else if (systemStatus.uptime < 86400) {
-    snprintf(uptimeText, sizeof(uptimeText), "UP:%luh", systemStatus.uptime / 3600);
+  if (frameState.systemStatus.uptime < 3600) {
+    snprintf(uptimeText, sizeof(uptimeText), "UP:%lum", frameState.systemStatus.uptime / 60);
+  } else if (frameState.systemStatus.uptime < 86400) {
+    snprintf(uptimeText, sizeof(uptimeText), "UP:%luh", frameState.systemStatus.uptime / 3600);
   } else {
-    snprintf(uptimeText, sizeof(uptimeText), "UP:%lud", systemStatus.uptime / 86400);
+    snprintf(uptimeText, sizeof(uptimeText), "UP:%lud", frameState.systemStatus.uptime / 86400);
   }
   
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString(uptimeText, infoX, infoY + 2 * Layout::LINE_SPACING, 1);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString(uptimeText, infoX, infoY + 2 * Layout::LINE_SPACING, 1);
   
   // LDR-Wert rechts neben Uptime (geglätteter Wert für stabile Anzeige)
-  tft.setTextColor(Colors::TEXT_LABEL);
+  gfx.setTextColor(Colors::TEXT_LABEL);
   char ldrText[16];
-  snprintf(ldrText, sizeof(ldrText), " LDR:%d", systemStatus.ldrValueSmoothed);
-  tft.drawString(ldrText, infoX + 35, infoY + 2 * Layout::LINE_SPACING, 1);
+  snprintf(ldrText, sizeof(ldrText), " LDR:%d", frameState.systemStatus.ldrValueSmoothed);
+  gfx.drawString(ldrText, infoX + 35, infoY + 2 * Layout::LINE_SPACING, 1);
 }
 
 void drawNetworkStatus() {
-  int netX = Layout::NETWORK_INFO_X + antiBurnin.getOffsetX();
-  int netY = Layout::NETWORK_INFO_Y;  // Gleiche Höhe wie System-Info
+  ProfileScope profile(PROFILE_NETWORK_STATUS);
+  TFT_eSPI& gfx = canvas();
+  const WidgetLayout& area = WIDGETS[WIDGET_NETWORK_STATUS];
+  int netX = area.x + frameState.antiBurnin.getOffsetX();
+  int netY = area.y;  // Gleiche Höhe wie System-Info
   
-  // Erweiterten Bereich löschen (für 3 Zeilen untereinander)
-  tft.fillRect(netX, netY, Layout::NETWORK_INFO_WIDTH, Layout::LINE_SPACING * Layout::NETWORK_INFO_LINES, Colors::BG_MAIN);
+  // Bereich löschen (3 Zeilen untereinander)
+  gfx.fillRect(netX, netY, area.w, area.h, Colors::BG_MAIN);
   
   // WiFi-Status (erste Zeile)
-  if (systemStatus.wifiConnected) {
-    tft.setTextColor(Colors::TEXT_LABEL);
+  if (frameState.systemStatus.wifiConnected) {
+    gfx.setTextColor(Colors::TEXT_LABEL);
     
     char wifiText[32];
-    int bars = getSignalBars(systemStatus.wifiRSSI);
-    snprintf(wifiText, sizeof(wifiText), "WiFi:%ddBm ", systemStatus.wifiRSSI);
+    int bars = getSignalBars(frameState.systemStatus.wifiRSSI);
+    snprintf(wifiText, sizeof(wifiText), "WiFi:%ddBm ", frameState.systemStatus.wifiRSSI);
 
     // Add signal bars to string (█ = voll, ░ = leer)
     size_t len = strlen(wifiText);
@@ -1004,62 +2119,74 @@ void drawNetworkStatus() {
       wifiText[len++] = (i < bars) ? '|' : '.';  // Clearer visual representation
     }
     wifiText[len] = '\0';
-    tft.drawString(wifiText, netX, netY, 1);
+    gfx.drawString(wifiText, netX, netY, 1);
   } else {
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("WiFi:FEHLER", netX, netY, 1);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("WiFi:FEHLER", netX, netY, 1);
   }
   
   // MQTT-Status (zweite Zeile)
-  const char* mqttText = systemStatus.mqttConnected ? "MQTT:OK" : "MQTT:FEHLER";
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString(mqttText, netX, netY + Layout::LINE_SPACING, 1);
+  const char* mqttText = frameState.systemStatus.mqttConnected ? "MQTT:OK" : "MQTT:FEHLER";
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString(mqttText, netX, netY + Layout::LINE_SPACING, 1);
   
   // OTA-Status (dritte Zeile)
-  if (isOTAActive()) {
-    // Temporarily get String, but at least limit memory allocation
-    String otaStatus = getOTAStatus();
+  if (frameState.otaActive) {
     char otaStatusText[32];
-    snprintf(otaStatusText, sizeof(otaStatusText), "OTA:%s", otaStatus.c_str());
-    int progress = getOTAProgress();
+    snprintf(otaStatusText, sizeof(otaStatusText), "OTA:%s", frameState.otaStatus);
 
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString(otaStatusText, netX, netY + 2 * Layout::LINE_SPACING, 1);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString(otaStatusText, netX, netY + 2 * Layout::LINE_SPACING, 1);
   } else {
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("OTA:Bereit", netX, netY + 2 * Layout::LINE_SPACING, 1);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("OTA:Bereit", netX, netY + 2 * Layout::LINE_SPACING, 1);
   }
 }
 
 
 void drawTimeDisplay() {
-  int timeX = 240 + antiBurnin.getOffsetX();
-  int timeY = 8;
+  ProfileScope profile(PROFILE_TIME_DISPLAY);
+  TFT_eSPI& gfx = canvas();
+  const WidgetLayout& area = WIDGETS[WIDGET_TIME];
+  int timeX = area.x + frameState.antiBurnin.getOffsetX();
+  int timeY = area.y;
   
   // Alten Bereich löschen
-  tft.fillRect(timeX, timeY, 80, 32, Colors::BG_MAIN);
+  gfx.fillRect(timeX, timeY, area.w, area.h, Colors::BG_MAIN);
   
-  if (systemStatus.timeValid) {
+  if (frameState.systemStatus.timeValid) {
     // Uhrzeit groß anzeigen
-    tft.setTextColor(Colors::TEXT_MAIN);
-    tft.drawString(systemStatus.currentTime, timeX, timeY, 2);
+    drawCachedString(gfx, frameState.systemStatus.currentTime, timeX, timeY, 2, Colors::TEXT_MAIN);
     
     // Datum kleiner darunter
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString(systemStatus.currentDate, timeX, timeY + 18, 1);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString(frameState.systemStatus.currentDate, timeX, timeY + 18, 1);
   } else {
-    tft.setTextColor(Colors::SYSTEM_ERROR);
-    tft.drawString("--:--:--", timeX, timeY, 2);
-    tft.drawString("Zeit-Sync", timeX, timeY + 18, 1);
+    drawCachedString(gfx, "--:--:--", timeX, timeY, 2, Colors::SYSTEM_ERROR);
+    gfx.drawString("Zeit-Sync", timeX, timeY + 18, 1);
   }
 }
 
+// Messzeile im reservierten Streifen; ausgeblendet nur Hintergrund
+void drawDebugHud() {
+  TFT_eSPI& gfx = canvas();
+  const WidgetLayout& area = WIDGETS[WIDGET_DEBUG_HUD];
+  int hudX = area.x + frameState.antiBurnin.getOffsetX();
+  int hudY = area.y;
+
+  gfx.fillRect(hudX, hudY, area.w, area.h, Colors::BG_MAIN);
+  if (!frameState.debugHudVisible) return;
+
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString(frameState.debugHudText, hudX, hudY + 2, 1);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              ECO-VISUALISIERUNG
 // ═══════════════════════════════════════════════════════════════════════════════
 
 void drawEcoVisualization(int x, int y) {
-  if (loadPower < PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
+  if (frameState.loadPower < PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
     // Kein Verbrauch - zeige Standby-Symbol
     tft.setTextColor(Colors::TEXT_LABEL);
     tft.drawString("~", x, y, 2);
@@ -1067,10 +2194,10 @@ void drawEcoVisualization(int x, int y) {
   }
   
   // Berechne Eco-Score basierend auf Energiequellen
-  float totalConsumption = loadPower;
-  float pvDirectUse = min(pvPower, totalConsumption);
-  float batteryUse = (!isStorageCharging && storagePower > 0) ? 
-                     min(storagePower, totalConsumption - pvDirectUse) : 0.0f;
+  float totalConsumption = frameState.loadPower;
+  float pvDirectUse = min(frameState.pvPower, totalConsumption);
+  float batteryUse = (!frameState.isStorageCharging && frameState.storagePower > 0) ? 
+                     min(frameState.storagePower, totalConsumption - pvDirectUse) : 0.0f;
   float gridUse = totalConsumption - pvDirectUse - batteryUse;
   
   // Nachhaltigkeit berechnen (0-100%) - SICHER gegen Division by Zero
@@ -1147,8 +2274,9 @@ uint16_t getSensorProgressColor(int sensorIndex) {
 // ═══════════════════════════════════════════════════════════════════════════════
 
 void drawProgressBar(int x, int y, int width, float percentage, bool showText, uint16_t customColor) {
-  tft.drawRect(x, y, width, Layout::PROGRESS_BAR_HEIGHT, Colors::BORDER_PROGRESS);
-  tft.fillRect(x + 1, y + 1, width - 2, Layout::PROGRESS_BAR_HEIGHT - 2, Colors::BG_MAIN);
+  TFT_eSPI& gfx = canvas();
+  gfx.drawRect(x, y, width, Layout::PROGRESS_BAR_HEIGHT, Colors::BORDER_PROGRESS);
+  gfx.fillRect(x + 1, y + 1, width - 2, Layout::PROGRESS_BAR_HEIGHT - 2, Colors::BG_MAIN);
 
   int progressWidth = constrain((width - 2) * (percentage / 100.0f), 0, width - 2);
   uint16_t progressColor;
@@ -1165,25 +2293,27 @@ void drawProgressBar(int x, int y, int width, float percentage, bool showText, u
   }
   
   if (progressWidth > 0) {
-    tft.fillRect(x + 1, y + 1, progressWidth, Layout::PROGRESS_BAR_HEIGHT - 2, progressColor);
+    gfx.fillRect(x + 1, y + 1, progressWidth, Layout::PROGRESS_BAR_HEIGHT - 2, progressColor);
   }
   
   if (showText) {
-    tft.setTextColor(Colors::TEXT_MAIN);
+    gfx.setTextColor(Colors::TEXT_MAIN);
     char percentageText[8];
     snprintf(percentageText, sizeof(percentageText), "%.0f%%", percentage);
-    tft.drawString(percentageText, x + width + Layout::PADDING_MEDIUM, y - 2, 1);
+    gfx.drawString(percentageText, x + width + Layout::PADDING_MEDIUM, y - 2, 1);
   }
 }
 
 void drawIndicator(int x, int y, uint16_t color, bool withBorder) {
-  tft.fillCircle(x, y, Layout::INDICATOR_RADIUS, color);
+  TFT_eSPI& gfx = canvas();
+  gfx.fillCircle(x, y, Layout::INDICATOR_RADIUS, color);
   if (withBorder) {
-    tft.drawCircle(x, y, Layout::INDICATOR_RADIUS, Colors::BORDER_INDICATOR);
+    gfx.drawCircle(x, y, Layout::INDICATOR_RADIUS, Colors::BORDER_INDICATOR);
   }
 }
 
 void drawTrendArrow(int x, int y, SensorData::TrendDirection trend, int sensorIndex) {
+  TFT_eSPI& gfx = canvas();
   // Verwende die sensor-spezifische Farb-Logik
   uint16_t arrowColor = getTrendArrowColor(sensorIndex, trend);
   
@@ -1193,20 +2323,20 @@ void drawTrendArrow(int x, int y, SensorData::TrendDirection trend, int sensorIn
   if (trend == SensorData::UP) {
     // Subtiler Glow-Effekt (optional): Größeres, blasseres Dreieck im Hintergrund
     uint16_t glowColor = (arrowColor & 0xF79E) >> 1; // Farbe halbiert für Glow
-    tft.fillTriangle(x, y - 3,                    
+    gfx.fillTriangle(x, y - 3,                    
                      x - (arrowSize+1)/2, y + 5,      
                      x + (arrowSize+1)/2, y + 5,      
                      glowColor);
     
     // Hauptpfeil: Aufwärts-Dreieck (gefüllt)
-    tft.fillTriangle(x, y - 2,                    // Spitze oben
+    gfx.fillTriangle(x, y - 2,                    // Spitze oben
                      x - arrowSize/2, y + 4,      // Linke Ecke unten
                      x + arrowSize/2, y + 4,      // Rechte Ecke unten
                      arrowColor);
     
     // Dezenter Rahmen nur bei wichtigen Trends
     if (arrowColor == Colors::TREND_UP_STRONG || arrowColor == Colors::TREND_DOWN_STRONG) {
-      tft.drawTriangle(x, y - 2,
+      gfx.drawTriangle(x, y - 2,
                        x - arrowSize/2, y + 4,
                        x + arrowSize/2, y + 4,
                        Colors::TEXT_LABEL);
@@ -1215,20 +2345,20 @@ void drawTrendArrow(int x, int y, SensorData::TrendDirection trend, int sensorIn
   } else if (trend == SensorData::DOWN) {
     // Subtiler Glow-Effekt
     uint16_t glowColor = (arrowColor & 0xF79E) >> 1;
-    tft.fillTriangle(x, y + 5,                    
+    gfx.fillTriangle(x, y + 5,                    
                      x - (arrowSize+1)/2, y - 3,      
                      x + (arrowSize+1)/2, y - 3,      
                      glowColor);
     
     // Hauptpfeil: Abwärts-Dreieck (gefüllt)
-    tft.fillTriangle(x, y + 4,                    // Spitze unten
+    gfx.fillTriangle(x, y + 4,                    // Spitze unten
                      x - arrowSize/2, y - 2,      // Linke Ecke oben
                      x + arrowSize/2, y - 2,      // Rechte Ecke oben
                      arrowColor);
     
     // Dezenter Rahmen nur bei wichtigen Trends
     if (arrowColor == Colors::TREND_UP_STRONG || arrowColor == Colors::TREND_DOWN_STRONG) {
-      tft.drawTriangle(x, y + 4,
+      gfx.drawTriangle(x, y + 4,
                        x - arrowSize/2, y - 2,
                        x + arrowSize/2, y - 2,
                        Colors::TEXT_LABEL);
@@ -1241,14 +2371,14 @@ void drawTrendArrow(int x, int y, SensorData::TrendDirection trend, int sensorIn
     
     // Subtiler Glow-Hintergrund
     uint16_t glowColor = (arrowColor & 0xF79E) >> 1;
-    tft.fillRect(x - (barWidth+2)/2, y - 1, barWidth + 2, barHeight + 2, glowColor);
+    gfx.fillRect(x - (barWidth+2)/2, y - 1, barWidth + 2, barHeight + 2, glowColor);
     
     // Hauptbalken
-    tft.fillRect(x - barWidth/2, y, barWidth, barHeight, arrowColor);
+    gfx.fillRect(x - barWidth/2, y, barWidth, barHeight, arrowColor);
     
     // Perfekt abgerundete Enden
-    tft.fillCircle(x - barWidth/2, y + barHeight/2, barHeight/2, arrowColor);
-    tft.fillCircle(x + barWidth/2, y + barHeight/2, barHeight/2, arrowColor);
+    gfx.fillCircle(x - barWidth/2, y + barHeight/2, barHeight/2, arrowColor);
+    gfx.fillCircle(x + barWidth/2, y + barHeight/2, barHeight/2, arrowColor);
   }
 }
 
@@ -1263,8 +2393,8 @@ uint16_t getTrendArrowColor(int index, SensorData::TrendDirection trend) {
   bool isStrongChange = false;
   if (index < System::SENSOR_COUNT) {
     float changePercent = 0.0f;
-    if (sensors[index].lastValue > 0) {
-      changePercent = abs(sensors[index].value - sensors[index].lastValue) / sensors[index].lastValue * 100.0f;
+    if (frameState.sensors[index].lastValue > 0) {
+      changePercent = abs(frameState.sensors[index].value - frameState.sensors[index].lastValue) / frameState.sensors[index].lastValue * 100.0f;
       isStrongChange = (changePercent > 5.0f); // > 5% Änderung = "stark"
     }
   }
@@ -1319,34 +2449,42 @@ uint16_t getTrendArrowColor(int index, SensorData::TrendDirection trend) {
 }
 
 void drawConsumptionBar(int x, int y, int width, float maxConsumption) {
+  ProfileScope profile(PROFILE_CONSUMPTION_BAR);
+  TFT_eSPI& gfx = canvas();
   // Verbesserte Consumption Bar - gleiche Größe wie Ladestand-Balken
   const float MIN_SEGMENT_WIDTH = 4.0f; // Etwas kleinere Mindestbreite
   const float MIN_CONSUMPTION_THRESHOLD = 0.02f; // Reduzierter Schwellwert
   int barHeight = Layout::PROGRESS_BAR_HEIGHT; // Gleiche Höhe wie normale Progress Bars
   
   // Hintergrund löschen
-  tft.fillRect(x, y - 2, width, barHeight + 4, Colors::BG_MAIN);
+  gfx.fillRect(x, y - 2, width, barHeight + 4, Colors::BG_MAIN);
   
   // Robuste Verbrauchsberechnung mit Validierung
-  float totalConsumption = max(0.0f, loadPower); // Negative Werte abfangen
+  float totalConsumption = max(0.0f, frameState.loadPower); // Negative Werte abfangen
+  
+  SegmentBar bar;
+  bar.x = x;
+  bar.y = y;
+  bar.width = width;
+  bar.height = barHeight;
   
   if (totalConsumption < PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
     // Sehr geringer Verbrauch - zeige leeren Balken
-    tft.drawRect(x, y, width, barHeight, Colors::BORDER_PROGRESS);
+    finishSegmentBar(gfx, bar, width);
     return;
   }
   
   // Robuste Energiequellen-Berechnung mit Validierung
-  float pvDirectUse = max(0.0f, min(max(0.0f, pvPower), totalConsumption));
+  float pvDirectUse = max(0.0f, min(max(0.0f, frameState.pvPower), totalConsumption));
   float remainingConsumption = max(0.0f, totalConsumption - pvDirectUse);
   
   float batteryUse = 0.0f;
   float gridUse = 0.0f;
   
   if (remainingConsumption > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
-    if (!isStorageCharging && storagePower > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
+    if (!frameState.isStorageCharging && frameState.storagePower > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
       // Batterie entlädt - sichere Berechnung
-      batteryUse = max(0.0f, min(storagePower, remainingConsumption));
+      batteryUse = max(0.0f, min(frameState.storagePower, remainingConsumption));
       gridUse = max(0.0f, remainingConsumption - batteryUse);
     } else {
       // Kein Batterieeinsatz oder Batterie lädt
@@ -1407,92 +2545,93 @@ void drawConsumptionBar(int x, int y, int width, float maxConsumption) {
   
   // PV-Segment (grün)
   if (pvWidth > 0) {
-    tft.fillRect(currentX, y, min(pvWidth, width), barHeight, Colors::STATUS_GREEN);
+    fillBarSegment(gfx, bar, currentX, min(pvWidth, width), Colors::STATUS_GREEN);
     currentX += pvWidth;
   }
   
   // Batterie-Segment (blau)
   if (batteryWidth > 0 && currentX < x + width) {
     int segmentWidth = min(batteryWidth, (x + width) - currentX);
-    tft.fillRect(currentX, y, segmentWidth, barHeight, Colors::STATUS_BLUE);
+    fillBarSegment(gfx, bar, currentX, segmentWidth, Colors::STATUS_BLUE);
     currentX += batteryWidth;
   }
   
   // Netz-Segment (rot)
   if (gridWidth > 0 && currentX < x + width) {
     int segmentWidth = min(gridWidth, (x + width) - currentX);
-    tft.fillRect(currentX, y, segmentWidth, barHeight, Colors::STATUS_RED);
+    fillBarSegment(gfx, bar, currentX, segmentWidth, Colors::STATUS_RED);
   }
   
   // Rahmen um den gesamten verfügbaren Bereich
-  tft.drawRect(x, y, totalBarWidth, barHeight, Colors::BORDER_PROGRESS);
+  finishSegmentBar(gfx, bar, totalBarWidth);
   
   // Keine zusätzlichen Labels - nur der farbige Balken zur Visualisierung
-  
-  Serial.printf("Robust Consumption: %.1fkW (PV:%.2f Bat:%.2f Grid:%.2f) Widths:(%d,%d,%d)\n",
-                totalConsumption, pvDirectUse, batteryUse, gridUse, pvWidth, batteryWidth, gridWidth);
 }
 
 void drawBidirectionalBar(int x, int y, int width, float pvPower, float gridPower, float maxPower) {
+  ProfileScope profile(PROFILE_BIDIRECTIONAL_BAR);
+  TFT_eSPI& gfx = canvas();
   // Bidirektionale Balken-Logik mit berechneten Richtungen
   int centerX = x + width / 2;
   int barHeight = PowerManagement::BIDIRECTIONAL_BAR_HEIGHT;
   
   // Hintergrund löschen
-  tft.fillRect(x, y, width, barHeight, Colors::BG_MAIN);
+  gfx.fillRect(x, y, width, barHeight, Colors::BG_MAIN);
   
   // Mittellinie (immer sichtbar)
-  tft.drawFastVLine(centerX, y - 1, barHeight + 2, Colors::BORDER_PROGRESS);
+  gfx.drawFastVLine(centerX, y - 1, barHeight + 2, Colors::BORDER_PROGRESS);
   
   // Prüfe ob gridPower nahe Null ist (perfekte Balance)
   bool gridNearZero = (gridPower < PowerManagement::GRID_BALANCE_THRESHOLD);
   
   if (gridNearZero) {
     // Perfekte Energiebilanz - zeige Batterie-Symbol
-    tft.setTextColor(Colors::STATUS_CYAN);
-    tft.drawString("BAL", centerX - 8, y - 8, 1);
+    gfx.setTextColor(Colors::STATUS_CYAN);
+    gfx.drawString("BAL", centerX - 8, y - 8, 1);
     
     // Dünner cyan Balken in der Mitte
-    tft.fillRect(centerX - 5, y + 1, 10, barHeight - 2, Colors::STATUS_CYAN);
+    gfx.fillRect(centerX - 5, y + 1, 10, barHeight - 2, Colors::STATUS_CYAN);
     
   } else {
     // Grid-Leistung anzeigen basierend auf berechneter Richtung
     float gridRatio = constrain(gridPower / maxPower, 0.0f, 1.0f);
     int gridBarWidth = (int)((width / 2) * gridRatio);
     
-    if (!isGridFeedIn) {
+    if (!frameState.isGridFeedIn) {
       // Bezug - Unterscheidung zwischen Netz (rot) und Speicher (blau)
       uint16_t bezugColor = Colors::STATUS_RED;  // Default: Netzbezug
       const char* bezugText = "Netz";
 
       // Prüfen ob Energie aus Speicher kommt (wenn Speicherleistung negativ ist)
-      if (storagePower > 0.1f && !isStorageCharging) {
+      if (frameState.storagePower > 0.1f && !frameState.isStorageCharging) {
         bezugColor = Colors::STATUS_BLUE;  // Speicherbezug
         bezugText = "Speicher";
       }
 
-      tft.fillRect(centerX - gridBarWidth, y, gridBarWidth, barHeight, bezugColor);
-      tft.setTextColor(bezugColor);
-      tft.drawString(bezugText, x + 2, y - 8, 1);
+      gfx.fillRect(centerX - gridBarWidth, y, gridBarWidth, barHeight, bezugColor);
+      gfx.setTextColor(bezugColor);
+      gfx.drawString(bezugText, x + 2, y - 8, 1);
 
     } else {
       // Netzeinspeisung nach rechts (grün)
-      tft.fillRect(centerX + 1, y, gridBarWidth, barHeight, Colors::STATUS_GREEN);
-      tft.setTextColor(Colors::STATUS_GREEN);
-      tft.drawString("Feed", x + width - 18, y - 8, 1);
+      gfx.fillRect(centerX + 1, y, gridBarWidth, barHeight, Colors::STATUS_GREEN);
+      gfx.setTextColor(Colors::STATUS_GREEN);
+      gfx.drawString("Feed", x + width - 18, y - 8, 1);
     }
   }
   
   // Rahmen um gesamten Balken
-  tft.drawRect(x, y, width, barHeight, Colors::BORDER_PROGRESS);
+  gfx.drawRect(x, y, width, barHeight, Colors::BORDER_PROGRESS);
   
   const char* status = gridNearZero ? "[BALANCE]" :
-                      (isGridFeedIn ? "[EINSPEISUNG]" : "[BEZUG]");
+                      (frameState.isGridFeedIn ? "[EINSPEISUNG]" : "[BEZUG]");
   Serial.printf("🔄 Grid-Balken: %.1fkW %s (PV=%.1f, Load=%.1f, Storage=%.1f)\n",
-               gridPower, status, pvPower, loadPower, storagePower);
+               gridPower, status, pvPower, frameState.loadPower, frameState.storagePower);
 }
 
 void drawPVDistributionBar(int x, int y, int width, float pvPower) {
+  ProfileScope profile(PROFILE_PV_DISTRIBUTION_BAR);
+  TFT_eSPI& gfx = canvas();
   // Segmentierte Progress Bar für PV-Erzeugung Aufteilung
   // Grün: Strom ins Auto (Wallbox), Blau: Strom in Hausspeicher, Rot: Strom ins Netz
 
@@ -1500,11 +2639,17 @@ void drawPVDistributionBar(int x, int y, int width, float pvPower) {
   int barHeight = Layout::PROGRESS_BAR_HEIGHT;
 
   // Hintergrund löschen
-  tft.fillRect(x, y - 1, width, barHeight + 2, Colors::BG_MAIN);
+  gfx.fillRect(x, y - 1, width, barHeight + 2, Colors::BG_MAIN);
+
+  SegmentBar bar;
+  bar.x = x;
+  bar.y = y;
+  bar.width = width;
+  bar.height = barHeight;
 
   if (pvPower < PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
     // Keine PV-Erzeugung - leerer Balken
-    tft.drawRect(x, y, width, barHeight, Colors::BORDER_PROGRESS);
+    finishSegmentBar(gfx, bar, width);
     return;
   }
 
@@ -1512,21 +2657,21 @@ void drawPVDistributionBar(int x, int y, int width, float pvPower) {
   float totalPV = max(0.0f, pvPower);
 
   // 1. Priorität: Direkter Hausverbrauch (nicht in der Bar, da das die Basis ist)
-  float directUse = min(totalPV, max(0.0f, loadPower));
+  float directUse = min(totalPV, max(0.0f, frameState.loadPower));
   float remainingPV = max(0.0f, totalPV - directUse);
 
   // 2. Priorität: Wallbox laden (echte wallboxPower verwenden)
   float toWallbox = 0.0f;
-  if (remainingPV > 0 && wallboxPower > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
+  if (remainingPV > 0 && frameState.wallboxPower > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
     // Verwende echte Wallbox-Leistung, aber maximal so viel wie noch übrig ist
-    toWallbox = min(remainingPV, wallboxPower);
+    toWallbox = min(remainingPV, frameState.wallboxPower);
     remainingPV = max(0.0f, remainingPV - toWallbox);
   }
 
   // 3. Priorität: Speicher laden
   float toStorage = 0.0f;
-  if (remainingPV > 0 && isStorageCharging && storagePower > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
-    toStorage = min(remainingPV, storagePower);
+  if (remainingPV > 0 && frameState.isStorageCharging && frameState.storagePower > PowerManagement::MIN_CONSUMPTION_THRESHOLD) {
+    toStorage = min(remainingPV, frameState.storagePower);
     remainingPV = max(0.0f, remainingPV - toStorage);
   }
 
@@ -1568,28 +2713,25 @@ void drawPVDistributionBar(int x, int y, int width, float pvPower) {
 
   // Wallbox-Segment (grün)
   if (wallboxWidth > 0) {
-    tft.fillRect(currentX, y, wallboxWidth, barHeight, Colors::STATUS_GREEN);
+    fillBarSegment(gfx, bar, currentX, wallboxWidth, Colors::STATUS_GREEN);
     currentX += wallboxWidth;
   }
 
   // Speicher-Segment (blau/cyan)
   if (storageWidth > 0 && currentX < x + width) {
     int segmentWidth = min(storageWidth, (x + width) - currentX);
-    tft.fillRect(currentX, y, segmentWidth, barHeight, Colors::STATUS_BLUE);
+    fillBarSegment(gfx, bar, currentX, segmentWidth, Colors::STATUS_BLUE);
     currentX += storageWidth;
   }
 
   // Netz-Segment (rot)
   if (gridWidth > 0 && currentX < x + width) {
     int segmentWidth = min(gridWidth, (x + width) - currentX);
-    tft.fillRect(currentX, y, segmentWidth, barHeight, Colors::STATUS_RED);
+    fillBarSegment(gfx, bar, currentX, segmentWidth, Colors::STATUS_RED);
   }
 
   // Rahmen um verfügbaren Bereich
-  tft.drawRect(x, y, totalBarWidth, barHeight, Colors::BORDER_PROGRESS);
-
-  Serial.printf("🔋 PV-Distribution: %.1fkW (Wallbox:%.2f Speicher:%.2f Netz:%.2f) Breiten:(%d,%d,%d)\n",
-                totalPV, toWallbox, toStorage, toGrid, wallboxWidth, storageWidth, gridWidth);
+  finishSegmentBar(gfx, bar, totalBarWidth);
 }
 
 uint16_t getTimeoutBoxColor(bool isTimedOut) {
@@ -1689,7 +2831,7 @@ void updateTouchMarkers() {
 
   // Wenn Marker abgelaufen sind, markiere partiellen Redraw
   if (hasExpiredMarkers) {
-    renderManager.markFullRedrawRequired();
+    frameState.renderManager.markPanelOverwritten();
     Serial.println("🔄 Touch-Marker Redraw ausgelöst");
   }
 }
@@ -1698,289 +2840,371 @@ void updateTouchMarkers() {
 //                              NEUE SUBPAGE-SCREENS
 // ═══════════════════════════════════════════════════════════════════════════════
 
-void drawWallboxConsumptionScreen() {
-  Serial.println("Zeichne Wallbox-Verbrauch-Screen...");
+// ── Hausspeicher (Wallbox- und Ladestand-Screen) ──
 
-  tft.fillScreen(Colors::BG_MAIN);
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
+struct StorageDisplayState {
+  float level;
+  const char* statusText;
+  uint16_t statusColor;
+};
+
+// Simulierter Speicher-Ladestand basierend auf aktueller Speicher-Aktivität
+static StorageDisplayState simulatedStorageState() {
+  StorageDisplayState state = {65.0f, "Standby", Colors::TEXT_MAIN};  // Basis-Wert 65%
+
+  // Dynamische Anpassung und Status-Text basierend auf Lade-/Entlade-Zustand
+  if (frameState.storagePower > 0.1f) {
+    if (frameState.isStorageCharging) {
+      // Beim Laden: höherer Ladestand anzeigen
+      state.level = min(95.0f, 65.0f + (frameState.storagePower * 5.0f));
+      state.statusText = "Laden";
+      state.statusColor = Colors::STATUS_GREEN;
+    } else {
+      // Beim Entladen: niedrigerer Ladestand anzeigen
+      state.level = max(15.0f, 65.0f - (frameState.storagePower * 3.0f));
+      state.statusText = "Entladen";
+      state.statusColor = Colors::STATUS_ORANGE;
+    }
+  }
+  return state;
+}
 
-  // Titel
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Wallbox Verbrauch", 10 + offsetX, 10 + offsetY, 2);
+// ── Wallbox-Verbrauch-Screen ──
 
-  // Zurück-Button (oben rechts)
-  int backButtonX = 270 + offsetX;
-  int backButtonY = 10 + offsetY;
-  tft.drawRoundRect(backButtonX, backButtonY, 40, 20, 3, Colors::BORDER_MAIN);
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Zurueck", backButtonX + 3, backButtonY + 6, 1);
+static void drawWallboxChrome() {
+  TFT_eSPI& gfx = canvas();
+  drawDetailHeader("Wallbox Verbrauch", 10);
 
   // Wallbox Leistung (groß anzeigen)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Aktuelle Leistung:", 10 + offsetX, 40, 2);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Aktuelle Leistung:", 10 + frameState.antiBurnin.getOffsetX(), 40, 2);
+}
 
-  // Wallbox-Daten aus Sensor[5] (war ursprünglich Wallbox)
-  if (!sensors[5].isTimedOut) {
-    tft.setTextColor(Colors::TEXT_MAIN);
-    tft.drawString(sensors[5].formattedValue, 10 + offsetX, 65, 4);
+// Wallbox-Daten aus Sensor[5] (war ursprünglich Wallbox)
+static void drawWallboxPower() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+
+  if (!frameState.sensors[5].isTimedOut) {
+    gfx.setTextColor(Colors::TEXT_MAIN);
+    gfx.drawString(frameState.sensors[5].formattedValue, 10 + offsetX, 65, 4);
 
     // Status neben der Leistung anzeigen
     uint16_t statusColor = Colors::STATUS_GREEN;
     const char* statusText = "Standby";
 
-    if (sensors[5].value > 0.5f) {
+    if (frameState.sensors[5].value > 0.5f) {
       statusColor = Colors::STATUS_BLUE;
       statusText = "Laden";
-    } else if (sensors[5].value > 0.1f) {
+    } else if (frameState.sensors[5].value > 0.1f) {
       statusColor = Colors::STATUS_YELLOW;
       statusText = "Bereit";
     }
 
     // Status-Text rechts neben der Leistung
-    tft.setTextColor(statusColor);
-    tft.drawString(statusText, 200 + offsetX, 75, 2);
+    gfx.setTextColor(statusColor);
+    gfx.drawString(statusText, 200 + offsetX, 75, 2);
 
   } else {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("--- W", 10 + offsetX, 65, 4);
-    tft.drawString("Keine Verbindung", 200 + offsetX, 75, 2);
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("--- W", 10 + offsetX, 65, 4);
+    gfx.drawString("Keine Verbindung", 200 + offsetX, 75, 2);
   }
+}
 
-  // Auto-Ladestand (nicht verfügbar)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Ladestand Auto:", 10 + offsetX, 110, 1);
-  tft.setTextColor(Colors::TEXT_TIMEOUT);
-  tft.drawString("nicht verfuegbar", 10 + offsetX, 125, 1);
-
-  // Hausspeicher-Ladestand (simuliert basierend auf Lade-/Entlade-Status)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Hausspeicher:", 10 + offsetX, 150, 1);
+static uint32_t wallboxPowerSignature() {
+  int status = (frameState.sensors[5].value > 0.5f) ? 2 : (frameState.sensors[5].value > 0.1f) ? 1 : 0;
+  return LayerSignature()
+    .add(frameState.sensors[5].isTimedOut ? 1 : 0)
+    .add(frameState.sensors[5].formattedValue)
+    .add(status)
+    .hash;
+}
 
-  // Simulierter Speicher-Ladestand basierend auf aktueller Speicher-Aktivität
-  float storageLevel = 65.0f; // Basis-Wert 65%
+static void drawWallboxLabels() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
 
-  // Dynamische Anpassung basierend auf Speicher-Aktivität
-  if (storagePower > 0.1f) {
-    if (isStorageCharging) {
-      // Beim Laden: höherer Ladestand anzeigen
-      storageLevel = min(95.0f, 65.0f + (storagePower * 5.0f));
-    } else {
-      // Beim Entladen: niedrigerer Ladestand anzeigen
-      storageLevel = max(15.0f, 65.0f - (storagePower * 3.0f));
-    }
-  }
+  // Auto-Ladestand (nicht verfügbar)
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Ladestand Auto:", 10 + offsetX, 110, 1);
+  gfx.setTextColor(Colors::TEXT_TIMEOUT);
+  gfx.drawString("nicht verfuegbar", 10 + offsetX, 125, 1);
 
-  // Status-Text basierend auf Lade-/Entlade-Zustand
-  const char* storageStatusText = "Standby";
-  uint16_t storageStatusColor = Colors::TEXT_MAIN;
+  // Hausspeicher-Ladestand (simuliert basierend auf Lade-/Entlade-Status)
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Hausspeicher:", 10 + offsetX, 150, 1);
+}
 
-  if (storagePower > 0.1f) {
-    if (isStorageCharging) {
-      storageStatusText = "Laden";
-      storageStatusColor = Colors::STATUS_GREEN;
-    } else {
-      storageStatusText = "Entladen";
-      storageStatusColor = Colors::STATUS_ORANGE;
-    }
-  }
+static void drawWallboxStorage() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  StorageDisplayState storage = simulatedStorageState();
 
-  tft.setTextColor(storageStatusColor);
+  gfx.setTextColor(storage.statusColor);
   char storageText[48];
-  snprintf(storageText, sizeof(storageText), "%.0f%% (%s)", storageLevel, storageStatusText);
-  tft.drawString(storageText, 10 + offsetX, 165, 1);
+  snprintf(storageText, sizeof(storageText), "%.0f%% (%s)", storage.level, storage.statusText);
+  gfx.drawString(storageText, 10 + offsetX, 165, 1);
 
   // Progress Bar für Hausspeicher
   int storageProgressX = 10 + offsetX;
   int storageProgressY = 180;
   int storageProgressWidth = 250;
-  drawProgressBar(storageProgressX, storageProgressY, storageProgressWidth, storageLevel, false, Colors::STATUS_BLUE);
-
-  // System-Info unter den Progress-Bars (kürzer halten)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("MQTT: home/PV/WallboxPower", 10 + offsetX, 200, 1);
-
-  Serial.println("Wallbox-Verbrauch-Screen vollständig gezeichnet");
+  drawProgressBar(storageProgressX, storageProgressY, storageProgressWidth, storage.level, false, Colors::STATUS_BLUE);
 }
 
-void drawLadestandScreen() {
-  Serial.println("Zeichne Ladestand-Screen...");
+static uint32_t storageSignature() {
+  StorageDisplayState storage = simulatedStorageState();
+  char powerText[16];
+  snprintf(powerText, sizeof(powerText), "%.1f", frameState.storagePower);
+  return LayerSignature()
+    .add(&storage.level, sizeof(storage.level))
+    .add(storage.statusText)
+    .add(powerText)
+    .hash;
+}
 
-  tft.fillScreen(Colors::BG_MAIN);
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
+// System-Info unter den Progress-Bars (kürzer halten)
+static void drawWallboxFooter() {
+  TFT_eSPI& gfx = canvas();
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("MQTT: home/PV/WallboxPower", 10 + frameState.antiBurnin.getOffsetX(), 200, 1);
+}
 
-  // Titel
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Ladestand", 10 + offsetX, 10 + offsetY, 2);
+static const ScreenLayer WALLBOX_LAYERS[] = {
+  {{0,   0, Layout::DISPLAY_WIDTH, 56}, drawWallboxChrome,  nullptr, false},
+  {{0,  65, Layout::DISPLAY_WIDTH, 27}, drawWallboxPower,   wallboxPowerSignature, false},
+  {{0, 110, Layout::DISPLAY_WIDTH, 48}, drawWallboxLabels,  nullptr, false},
+  {{0, 165, Layout::DISPLAY_WIDTH, 19}, drawWallboxStorage, storageSignature, false},
+  {{0, 200, Layout::DISPLAY_WIDTH,  8}, drawWallboxFooter,  nullptr, false},
+};
 
-  // Zurück-Button (oben rechts)
-  int backButtonX = 270 + offsetX;
-  int backButtonY = 10 + offsetY;
-  tft.drawRoundRect(backButtonX, backButtonY, 40, 20, 3, Colors::BORDER_MAIN);
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Zurueck", backButtonX + 3, backButtonY + 6, 1);
+static const DetailScreen WALLBOX_CONSUMPTION = {
+  WALLBOX_LAYERS, sizeof(WALLBOX_LAYERS) / sizeof(WALLBOX_LAYERS[0]), drawWallboxConsumptionScreen
+};
 
-  // Hausspeicher-Sektion
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Hausspeicher:", 10 + offsetX, 40, 2);
+void drawWallboxConsumptionScreen() {
+  Serial.println("Zeichne Wallbox-Verbrauch-Screen...");
+  drawDetailLayers(WALLBOX_CONSUMPTION);
+  Serial.println("Wallbox-Verbrauch-Screen vollständig gezeichnet");
+}
 
-  // Simulierter Speicher-Ladestand basierend auf aktueller Speicher-Aktivität
-  float storageLevel = 65.0f; // Basis-Wert 65%
+// ── Ladestand-Screen ──
 
-  // Dynamische Anpassung basierend auf Speicher-Aktivität
-  if (storagePower > 0.1f) {
-    if (isStorageCharging) {
-      // Beim Laden: höherer Ladestand anzeigen
-      storageLevel = min(95.0f, 65.0f + (storagePower * 5.0f));
-    } else {
-      // Beim Entladen: niedrigerer Ladestand anzeigen
-      storageLevel = max(15.0f, 65.0f - (storagePower * 3.0f));
-    }
-  }
+static void drawLadestandChrome() {
+  TFT_eSPI& gfx = canvas();
+  drawDetailHeader("Ladestand", 10);
 
-  // Status-Text basierend auf Lade-/Entlade-Zustand
-  const char* storageStatusText = "Standby";
-  uint16_t storageStatusColor = Colors::TEXT_MAIN;
+  // Hausspeicher-Sektion
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Hausspeicher:", 10 + frameState.antiBurnin.getOffsetX(), 40, 2);
+}
 
-  if (storagePower > 0.1f) {
-    if (isStorageCharging) {
-      storageStatusText = "Laden";
-      storageStatusColor = Colors::STATUS_GREEN;
-    } else {
-      storageStatusText = "Entladen";
-      storageStatusColor = Colors::STATUS_ORANGE;
-    }
-  }
+static void drawLadestandStorage() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  StorageDisplayState storage = simulatedStorageState();
 
   // Großer Prozent-Wert
-  tft.setTextColor(storageStatusColor);
+  gfx.setTextColor(storage.statusColor);
   char storageLevelText[8];
-  snprintf(storageLevelText, sizeof(storageLevelText), "%.0f%%", storageLevel);
-  tft.drawString(storageLevelText, 10 + offsetX, 65, 4);
+  snprintf(storageLevelText, sizeof(storageLevelText), "%.0f%%", storage.level);
+  gfx.drawString(storageLevelText, 10 + offsetX, 65, 4);
 
   // Status-Text
-  tft.setTextColor(storageStatusColor);
-  tft.drawString(storageStatusText, 10 + offsetX, 105, 2);
+  gfx.setTextColor(storage.statusColor);
+  gfx.drawString(storage.statusText, 10 + offsetX, 105, 2);
 
   // Leistung anzeigen wenn aktiv
-  if (storagePower > 0.1f) {
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Leistung:", 10 + offsetX, 130, 1);
-    tft.setTextColor(Colors::TEXT_MAIN);
+  if (frameState.storagePower > 0.1f) {
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Leistung:", 10 + offsetX, 130, 1);
+    gfx.setTextColor(Colors::TEXT_MAIN);
     char powerText[16];
-    snprintf(powerText, sizeof(powerText), "%.1f kW", storagePower);
-    tft.drawString(powerText, 80 + offsetX, 130, 1);
+    snprintf(powerText, sizeof(powerText), "%.1f kW", frameState.storagePower);
+    gfx.drawString(powerText, 80 + offsetX, 130, 1);
   }
 
   // Progress Bar für Hausspeicher-Ladestand
   int storageProgressX = 10 + offsetX;
   int storageProgressY = 150;
   int storageProgressWidth = 280;
-  drawProgressBar(storageProgressX, storageProgressY, storageProgressWidth, storageLevel, true, Colors::STATUS_BLUE);
+  drawProgressBar(storageProgressX, storageProgressY, storageProgressWidth, storage.level, true, Colors::STATUS_BLUE);
+}
 
-  // PKW-Ladestand-Platzhalter (für zukünftige Implementierung)
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("PKW-Ladestand:", 10 + offsetX, 185, 2);
+// PKW-Ladestand-Platzhalter (für zukünftige Implementierung)
+static void drawLadestandCarLabel() {
+  TFT_eSPI& gfx = canvas();
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("PKW-Ladestand:", 10 + frameState.antiBurnin.getOffsetX(), 185, 2);
+}
 
-  if (!sensors[3].isTimedOut) {
-    tft.setTextColor(Colors::TEXT_MAIN);
-    tft.drawString(sensors[3].formattedValue, 10 + offsetX, 205, 2);
+static void drawLadestandCar() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+
+  if (!frameState.sensors[3].isTimedOut) {
+    gfx.setTextColor(Colors::TEXT_MAIN);
+    gfx.drawString(frameState.sensors[3].formattedValue, 10 + offsetX, 205, 2);
 
     // Progress Bar für PKW-Ladestand (aktuell noch Sensor[3])
     int carProgressX = 10 + offsetX;
     int carProgressY = 220;
     int carProgressWidth = 280;
-    drawProgressBar(carProgressX, carProgressY, carProgressWidth, sensors[3].value, true, Colors::STATUS_BLUE);
+    drawProgressBar(carProgressX, carProgressY, carProgressWidth, frameState.sensors[3].value, true, Colors::STATUS_BLUE);
   } else {
-    tft.setTextColor(Colors::TEXT_TIMEOUT);
-    tft.drawString("Nicht verfuegbar", 10 + offsetX, 205, 2);
+    gfx.setTextColor(Colors::TEXT_TIMEOUT);
+    gfx.drawString("Nicht verfuegbar", 10 + offsetX, 205, 2);
   }
+}
 
-  Serial.println("Ladestand-Screen vollständig gezeichnet");
+static uint32_t ladestandCarSignature() {
+  char percentText[8];
+  snprintf(percentText, sizeof(percentText), "%.0f", frameState.sensors[3].value);
+  return LayerSignature()
+    .add(frameState.sensors[3].isTimedOut ? 1 : 0)
+    .add(frameState.sensors[3].formattedValue)
+    .add(percentText)
+    .hash;
 }
 
-void drawSettingsScreen() {
-  Serial.println("Zeichne Settings-Screen...");
+static const ScreenLayer LADESTAND_LAYERS[] = {
+  {{0,   0, Layout::DISPLAY_WIDTH,  56}, drawLadestandChrome,   nullptr, false},
+  {{0,  65, Layout::DISPLAY_WIDTH,  91}, drawLadestandStorage,  storageSignature, false},
+  {{0, 185, Layout::DISPLAY_WIDTH,  16}, drawLadestandCarLabel, nullptr, false},
+  {{0, 205, Layout::DISPLAY_WIDTH,  35}, drawLadestandCar,      ladestandCarSignature, false},
+};
 
-  tft.fillScreen(Colors::BG_MAIN);
-  int offsetX = antiBurnin.getOffsetX();
-  int offsetY = antiBurnin.getOffsetY();
+static const DetailScreen LADESTAND = {
+  LADESTAND_LAYERS, sizeof(LADESTAND_LAYERS) / sizeof(LADESTAND_LAYERS[0]), drawLadestandScreen
+};
+
+void drawLadestandScreen() {
+  Serial.println("Zeichne Ladestand-Screen...");
+  drawDetailLayers(LADESTAND);
+  Serial.println("Ladestand-Screen vollständig gezeichnet");
+}
 
-  // Titel
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Einstellungen", 10 + offsetX, 10 + offsetY, 2);
+// ── Settings-Screen ──
 
-  // Zurück-Button (oben rechts)
-  int backButtonX = 270 + offsetX;
-  int backButtonY = 10 + offsetY;
-  tft.drawRoundRect(backButtonX, backButtonY, 40, 20, 3, Colors::BORDER_MAIN);
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Zurueck", backButtonX + 3, backButtonY + 6, 1);
+static void drawSettingsChrome() {
+  TFT_eSPI& gfx = canvas();
+  drawDetailHeader("Einstellungen", 10);
 
   // Touch-Kalibrierung Sektion
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("Touch-Kalibrierung:", 10 + offsetX, 45, 2);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("Touch-Kalibrierung:", 10 + frameState.antiBurnin.getOffsetX(), 45, 2);
+}
+
+static void drawSettingsCalibration() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
 
   // Kalibrierungs-Status
-  bool hasCalibration = touchManager.hasValidCalibration();
+  bool hasCalibration = frameState.calibrated;
   uint16_t statusColor = hasCalibration ? Colors::STATUS_GREEN : Colors::STATUS_ORANGE;
   const char* statusText = hasCalibration ? "Kalibriert" : "Nicht kalibriert";
 
   drawIndicator(10 + offsetX, 75, statusColor, true);
-  tft.setTextColor(statusColor);
-  tft.drawString(statusText, 25 + offsetX, 70, 1);
+  gfx.setTextColor(statusColor);
+  gfx.drawString(statusText, 25 + offsetX, 70, 1);
 
   // Kalibrierungs-Button
-  int calibButtonX = 10 + offsetX;
-  int calibButtonY = 90;
-  int calibButtonW = 150;
-  int calibButtonH = 30;
+  DirtyRect calibButton = WIDGETS[WIDGET_CALIBRATION_START].at(offsetX, 0);
 
-  uint16_t buttonColor = touchManager.isCalibrating() ? Colors::STATUS_YELLOW : Colors::BORDER_MAIN;
-  tft.drawRoundRect(calibButtonX, calibButtonY, calibButtonW, calibButtonH, 5, buttonColor);
+  uint16_t buttonColor = frameState.calibrating ? Colors::STATUS_YELLOW : Colors::BORDER_MAIN;
+  gfx.drawRoundRect(calibButton.x, calibButton.y, calibButton.w, calibButton.h, 5, buttonColor);
 
-  tft.setTextColor(Colors::TEXT_MAIN);
-  const char* buttonText = touchManager.isCalibrating() ? "Kalibrierung aktiv..." : "Kalibrierung starten";
-  tft.drawString(buttonText, calibButtonX + 5, calibButtonY + 8, 1);
+  gfx.setTextColor(Colors::TEXT_MAIN);
+  const char* buttonText = frameState.calibrating ? "Kalibrierung aktiv..." : "Kalibrierung starten";
+  gfx.drawString(buttonText, calibButton.x + 5, calibButton.y + 8, 1);
 
   // Kalibrierungs-Anweisungen
-  if (touchManager.isCalibrating()) {
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Kalibrierung aktiv:", 10 + offsetX, 130, 1);
-    tft.drawString("Touchscreen wird neu", 10 + offsetX, 145, 1);
-    tft.drawString("kalibriert...", 10 + offsetX, 160, 1);
+  if (frameState.calibrating) {
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Kalibrierung aktiv:", 10 + offsetX, 130, 1);
+    gfx.drawString("Touchscreen wird neu", 10 + offsetX, 145, 1);
+    gfx.drawString("kalibriert...", 10 + offsetX, 160, 1);
 
     // Beenden-Button während Kalibrierung
-    int stopButtonX = 170 + offsetX;
-    int stopButtonY = 90;
-    int stopButtonW = 100;
-    int stopButtonH = 30;
+    DirtyRect stopButton = WIDGETS[WIDGET_CALIBRATION_STOP].at(offsetX, 0);
 
-    tft.drawRoundRect(stopButtonX, stopButtonY, stopButtonW, stopButtonH, 5, Colors::STATUS_RED);
-    tft.setTextColor(Colors::TEXT_MAIN);
-    tft.drawString("Beenden", stopButtonX + 25, stopButtonY + 8, 1);
+    gfx.drawRoundRect(stopButton.x, stopButton.y, stopButton.w, stopButton.h, 5, Colors::STATUS_RED);
+    gfx.setTextColor(Colors::TEXT_MAIN);
+    gfx.drawString("Beenden", stopButton.x + 25, stopButton.y + 8, 1);
 
   } else {
-    tft.setTextColor(Colors::TEXT_LABEL);
-    tft.drawString("Touch-Genauigkeit optimieren", 10 + offsetX, 130, 1);
-    tft.drawString("durch Neu-Kalibrierung", 10 + offsetX, 145, 1);
+    gfx.setTextColor(Colors::TEXT_LABEL);
+    gfx.drawString("Touch-Genauigkeit optimieren", 10 + offsetX, 130, 1);
+    gfx.drawString("durch Neu-Kalibrierung", 10 + offsetX, 145, 1);
   }
+}
+
+static uint32_t settingsCalibrationSignature() {
+  return LayerSignature()
+    .add(frameState.calibrated ? 1 : 0)
+    .add(frameState.calibrating ? 1 : 0)
+    .hash;
+}
+
+static void drawSettingsSystemLabels() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
 
   // System-Info
-  tft.setTextColor(Colors::TEXT_LABEL);
-  tft.drawString("System-Information:", 10 + offsetX, 180, 1);
+  gfx.setTextColor(Colors::TEXT_LABEL);
+  gfx.drawString("System-Information:", 10 + offsetX, 180, 1);
+
+  gfx.drawString("Firmware: ESP32 Rev2", 10 + offsetX, 195, 1);
+}
 
-  tft.drawString("Firmware: ESP32 Rev2", 10 + offsetX, 195, 1);
+static void drawSettingsSystemValues() {
+  TFT_eSPI& gfx = canvas();
+  int offsetX = frameState.antiBurnin.getOffsetX();
+  gfx.setTextColor(Colors::TEXT_LABEL);
 
   char uptimeInfo[32];
-  snprintf(uptimeInfo, sizeof(uptimeInfo), "Uptime: %luh", systemStatus.uptime / 3600);
-  tft.drawString(uptimeInfo, 10 + offsetX, 210, 1);
+  snprintf(uptimeInfo, sizeof(uptimeInfo), "Uptime: %luh", frameState.systemStatus.uptime / 3600);
+  gfx.drawString(uptimeInfo, 10 + offsetX, 210, 1);
 
   char memInfo[32];
-  snprintf(memInfo, sizeof(memInfo), "RAM: %luKB frei", systemStatus.freeHeap / 1024);
-  tft.drawString(memInfo, 10 + offsetX, 225, 1);
+  snprintf(memInfo, sizeof(memInfo), "RAM: %luKB frei", frameState.systemStatus.freeHeap / 1024);
+  gfx.drawString(memInfo, 10 + offsetX, 225, 1);
+}
+
+static uint32_t settingsSystemSignature() {
+  return LayerSignature()
+    .add((int)(frameState.systemStatus.uptime / 3600))
+    .add((int)(frameState.systemStatus.freeHeap / 1024))
+    .hash;
+}
+
+static const ScreenLayer SETTINGS_LAYERS[] = {
+  {{0,   0, Layout::DISPLAY_WIDTH,  61}, drawSettingsChrome,       nullptr, false},
+  {{0,  70, Layout::DISPLAY_WIDTH, 100}, drawSettingsCalibration,  settingsCalibrationSignature, false},
+  {{0, 180, Layout::DISPLAY_WIDTH,  23}, drawSettingsSystemLabels, nullptr, false},
+  {{0, 210, Layout::DISPLAY_WIDTH,  23}, drawSettingsSystemValues, settingsSystemSignature, false},
+};
+
+static const DetailScreen SETTINGS = {
+  SETTINGS_LAYERS, sizeof(SETTINGS_LAYERS) / sizeof(SETTINGS_LAYERS[0]), drawSettingsScreen
+};
 
+void drawSettingsScreen() {
+  Serial.println("Zeichne Settings-Screen...");
+  drawDetailLayers(SETTINGS);
   Serial.println("Settings-Screen vollständig gezeichnet");
 }
 
+static const DetailScreen* detailScreenFor(DisplayMode mode) {
+  switch (mode) {
+    case PRICE_DETAIL_SCREEN:        return &PRICE_DETAIL;
+    case DAYAHEAD_SCREEN:            return &PRICE_DETAIL;
+    case OEKOSTROM_DETAIL_SCREEN:    return &OEKOSTROM_DETAIL;
+    case WALLBOX_CONSUMPTION_SCREEN: return &WALLBOX_CONSUMPTION;
+    case LADESTAND_SCREEN:           return &LADESTAND;
+    case SETTINGS_SCREEN:            return &SETTINGS;
+    default:                         return nullptr;
+  }
+}
+
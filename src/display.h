@@ -4,13 +4,15 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "config.h"
+#include "profiler.h"
+#include "cached_layer.h"
 
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              EXTERNE ABHÄNGIGKEITEN
 // ═══════════════════════════════════════════════════════════════════════════════
 
 // Externe Objekte (definiert in main.cpp)
-extern TFT_eSPI tft;
+extern ProfiledTFT tft;
 extern SensorData sensors[];
 extern SystemStatus systemStatus;
 extern AntiBurninManager antiBurnin;
@@ -37,6 +39,47 @@ extern DayAheadPriceData dayAheadPrices;
 #include "touch.h"
 extern TouchManager touchManager;
 
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              FRAME-ZUSTAND
+// ═══════════════════════════════════════════════════════════════════════════════
+// Der Renderer zeichnet aus einer Kopie der obigen Daten. updateDisplay()
+// zieht sie zu Beginn des Frames unter DisplayLock (ein paar hundert Bytes
+// kopieren) und gibt am Ende nicht gezeichnete Änderungen zurück; gezeichnet
+// und übertragen wird ohne DisplayLock. MQTT, Touch und OTA ändern die
+// Live-Daten also, während das Panel noch den vorigen Stand bekommt.
+// Zeichenfunktionen lesen deshalb nur frameState, nie die Live-Globals;
+// Performance-Zähler (systemStatus.performance) schreiben sie weiter live.
+
+#include "debug_hud.h"
+
+struct FrameState {
+  SensorData sensors[System::SENSOR_COUNT];
+  SystemStatus systemStatus;
+  AntiBurninManager antiBurnin;
+  RenderManager renderManager;     // Change-Flags und Dirty-Rechtecke dieses Frames
+  DisplayMode currentMode = HOME_SCREEN;
+  DayAheadPriceData dayAheadPrices;
+
+  float stockPreviousClose = 0.0f;
+  float pvPower = 0.0f;
+  float gridPower = 0.0f;
+  float loadPower = 0.0f;
+  float storagePower = 0.0f;
+  float wallboxPower = 0.0f;
+  bool isGridFeedIn = false;
+  bool isStorageCharging = false;
+
+  // Zustand anderer Module, den Widgets anzeigen
+  bool otaActive = false;
+  char otaStatus[32] = "";
+  bool calibrating = false;
+  bool calibrated = false;
+  bool debugHudVisible = false;
+  char debugHudText[DebugHudConfig::TEXT_LENGTH] = "";
+};
+
+extern FrameState frameState;
+
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              DISPLAY-FUNKTIONEN
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -44,6 +87,11 @@ extern TouchManager touchManager;
 // Haupt-Render-Funktionen
 void updateDisplay();
 void drawHomeScreen();
+
+// Aktuelles Bild des Hauptpanels als Layer (Render-Kontext): der Home-Frame-
+// Layer, wenn er noch stimmt, sonst off-screen in 'scratch' aufgenommen.
+// nullptr ohne Band-Sprite, bei Layer-Überlauf oder unbekanntem Screen.
+const CachedLayer* captureMainScreen(CachedLayer& scratch);
 void drawPriceDetailScreen();
 void drawDayAheadDetailScreen();
 void drawPriceAnalytics(int offsetX);
@@ -53,7 +101,6 @@ void drawWallboxConsumptionScreen();
 void drawLadestandScreen();
 void drawSettingsScreen();
 void drawPriceChart(int offsetX);
-void clearOldElements();
 
 // Sensor und UI-Komponenten
 void drawSensorBox(int index);
@@ -61,6 +108,8 @@ void drawCombinedSensorBox(int index1, int index2, int x, int y, int width, int
 void drawSystemInfo();
 void drawNetworkStatus();  // Enthält jetzt auch OTA-Status
 void drawTimeDisplay();
+void drawDebugHud();
+void drawSettingsBox();
 
 // Zentrale Farbverwaltung
 uint16_t getSensorProgressColor(int sensorIndex);
@@ -91,4 +140,28 @@ uint16_t getRSSIColor(int rssi);
 // Netzwerk-Hilfsfunktionen
 uint16_t getSignalBars(int rssi);
 
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              SEGMENT-BALKEN (DELTA)
+// ═══════════════════════════════════════════════════════════════════════════════
+// Verbrauchs- und PV-Verteilungsbalken merken sich ihre Segmentgrenzen,
+// Farben und Rahmenbreite. Ändert sich an einer Sensor-Box nur der Balken
+// (Rest des Box-Sprites gleich, Panel seit dem letzten Push unberührt),
+// gehen nur die Spalten über SPI, deren Segment-Zugehörigkeit sich geändert
+// hat - statt der ganzen Box bzw. ihrer Kacheln.
+
+namespace SegmentBarConfig {
+  constexpr bool ENABLED = true;
+  constexpr int MAX_SEGMENTS = 3;
+  constexpr int MAX_RUNS = 6;         // mehr geänderte Spaltenläufe: ganze Box übertragen
+}
+
+struct SegmentBarStats {
+  unsigned long deltaPushes = 0;      // nur geänderte Balkenspalten übertragen
+  unsigned long fullPushes = 0;       // Box mit Balken komplett (Kachel-Cache)
+  unsigned long unchanged = 0;        // Balken und Box unverändert
+  unsigned long deltaPixels = 0;
+};
+
+extern SegmentBarStats segmentBarStats;
+
 #endif // DISPLAY_H
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "display_list.h"
+
+DisplayListStats displayListStats;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RECORDER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// FNV-1a über die Parameter eines Befehls
+static uint32_t hashCommand(const int32_t* values, int count) {
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < count; i++) {
+    uint32_t value = (uint32_t)values[i];
+    for (int b = 0; b < 4; b++) {
+      hash = (hash ^ (value & 0xFF)) * 16777619u;
+      value >>= 8;
+    }
+  }
+  return hash;
+}
+
+void DisplayListRecorder::begin(DisplayList& list) {
+  target = &list;
+  list.clear();
+  displayListStats.recordings++;
+}
+
+void DisplayListRecorder::record(Op op, int32_t x, int32_t y, int32_t w, int32_t h,
+                                 uint32_t color, uint32_t extra, uint32_t background) {
+  if (target == nullptr || w <= 0 || h <= 0) return;
+
+  // Komplett außerhalb des Panels: nichts zu übertragen
+  DirtyRect bounds = DirtyRect(x, y, w, h).clipped();
+  if (bounds.isEmpty()) return;
+
+  const int32_t values[] = {op, x, y, w, h, (int32_t)color, (int32_t)extra, (int32_t)background};
+  target->add(bounds, hashCommand(values, sizeof(values) / sizeof(values[0])));
+}
+
+void DisplayListRecorder::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  record(OP_PIXEL, x, y, 1, 1, color, 0);
+}
+
+void DisplayListRecorder::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+  // Hülle über beide Endpunkte, Richtung im Hash (gleiche Hülle, andere Diagonale)
+  int32_t x = min(xs, xe), y = min(ys, ye);
+  uint32_t direction = ((xs <= xe) == (ys <= ye)) ? 0 : 1;
+  record(OP_LINE, x, y, abs(xe - xs) + 1, abs(ye - ys) + 1, color, direction);
+}
+
+void DisplayListRecorder::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  record(OP_VLINE, x, y, 1, h, color, 0);
+}
+
+void DisplayListRecorder::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  record(OP_HLINE, x, y, w, 1, color, 0);
+}
+
+void DisplayListRecorder::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  record(OP_FILL, x, y, w, h, color, 0);
+}
+
+int16_t DisplayListRecorder::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+  // Vorschub wie beim echten Zeichnen über textWidth() der Bibliothek
+  char glyph[4] = {0};
+  if (uniCode < 0x80) {
+    glyph[0] = (char)uniCode;
+  } else if (uniCode < 0x800) {
+    glyph[0] = (char)(0xC0 | (uniCode >> 6));
+    glyph[1] = (char)(0x80 | (uniCode & 0x3F));
+  } else {
+    glyph[0] = (char)(0xE0 | (uniCode >> 12));
+    glyph[1] = (char)(0x80 | ((uniCode >> 6) & 0x3F));
+    glyph[2] = (char)(0x80 | (uniCode & 0x3F));
+  }
+  int16_t advance = textWidth(glyph, font);
+
+  // Hintergrundfarbe zählt nur, wenn sie gezeichnet wird
+  uint32_t background = (textbgcolor != textcolor) ? textbgcolor : textcolor;
+  record(OP_CHAR, x, y, advance, fontHeight(font), textcolor,
+         ((uint32_t)uniCode << 8) | font, background);
+  return advance;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              VERGLEICH
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static bool sameCommand(const DisplayCommand& a, const DisplayCommand& b) {
+  return a.hash == b.hash && a.bounds.x == b.bounds.x && a.bounds.y == b.bounds.y &&
+         a.bounds.w == b.bounds.w && a.bounds.h == b.bounds.h;
+}
+
+int diffDisplayLists(const DisplayList& previous, const DisplayList& current, RenderManager& manager) {
+  if (previous.overflow || current.overflow || previous.segmentCount != current.segmentCount) {
+    return -1;
+  }
+
+  int differing = 0;
+  for (int s = 0; s < current.segmentCount; s++) {
+    const DisplayCommand* before = &previous.commands[previous.segmentStart[s]];
+    const DisplayCommand* after = &current.commands[current.segmentStart[s]];
+    int beforeCount = previous.segmentLength(s);
+    int afterCount = current.segmentLength(s);
+
+    for (int i = 0; i < max(beforeCount, afterCount); i++) {
+      if (i < beforeCount && i < afterCount && sameCommand(before[i], after[i])) continue;
+
+      // Alte Pixel löschen, neue zeichnen
+      if (i < beforeCount) manager.markDirty(before[i].bounds);
+      if (i < afterCount) manager.markDirty(after[i].bounds);
+      differing++;
+    }
+  }
+  return differing;
+}
@@ -0,0 +1,122 @@
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              DISPLAY-LISTE
+// ═══════════════════════════════════════════════════════════════════════════════
+// Ein Frame wird zusätzlich zum Zeichnen als kompakte Befehlsliste erfasst:
+// pro Zeichenbefehl das betroffene Rechteck und ein Hash über Operation,
+// Geometrie, Farbe und (bei Text) Zeichen und Font. Der Vergleich mit der
+// Liste des vorherigen Frames liefert die Bereiche, in denen sich das Bild
+// tatsächlich ändert - nur diese gehen noch über SPI.
+
+namespace DisplayListConfig {
+  constexpr int MAX_COMMANDS = 640;   // 12 Byte je Befehl = 7,5 KB je Liste
+  constexpr int MAX_SEGMENTS = 8;     // ein Segment je Layer eines Screens
+  // Ab dieser abweichenden Fläche lohnt der Teil-Redraw nicht mehr (Vollbild)
+  constexpr long MAX_DIFF_PIXELS = (long)Layout::DISPLAY_WIDTH * Layout::DISPLAY_HEIGHT / 2;
+}
+
+struct DisplayCommand {
+  DirtyRect bounds;   // Hülle aller Pixel des Befehls (Bildschirmkoordinaten)
+  uint32_t hash;      // Operation, exakte Geometrie, Farben, Zeichen/Font
+};
+
+struct DisplayList {
+  DisplayCommand commands[DisplayListConfig::MAX_COMMANDS];
+  int count = 0;
+  int segmentStart[DisplayListConfig::MAX_SEGMENTS + 1] = {};
+  int segmentCount = 0;
+  bool overflow = false;      // Liste unvollständig - nicht vergleichbar
+
+  void clear() {
+    count = 0;
+    segmentCount = 0;
+    segmentStart[0] = 0;
+    overflow = false;
+  }
+
+  // Neues Segment beginnen; Befehle danach gehören zu diesem Segment
+  void beginSegment() {
+    if (segmentCount >= DisplayListConfig::MAX_SEGMENTS) {
+      overflow = true;
+      return;
+    }
+    segmentStart[segmentCount++] = count;
+    segmentStart[segmentCount] = count;
+  }
+
+  void add(const DirtyRect& bounds, uint32_t hash) {
+    if (count >= DisplayListConfig::MAX_COMMANDS || segmentCount == 0) {
+      overflow = true;
+      return;
+    }
+    commands[count++] = {bounds, hash};
+    segmentStart[segmentCount] = count;
+  }
+
+  int segmentLength(int segment) const {
+    return segmentStart[segment + 1] - segmentStart[segment];
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RECORDER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Zeichenziel für canvas(), das keine Pixel erzeugt, sondern die virtuellen
+// Primitive von TFT_eSPI als Befehle in eine DisplayList schreibt. Text wird
+// pro Zeichen (drawChar) erfasst, nicht pro Pixel.
+
+class DisplayListRecorder : public TFT_eSPI {
+public:
+  DisplayListRecorder() : TFT_eSPI(Layout::DISPLAY_WIDTH, Layout::DISPLAY_HEIGHT) {}
+
+  // Ab jetzt in 'list' aufzeichnen (Liste wird geleert)
+  void begin(DisplayList& list);
+
+  using TFT_eSPI::drawChar;
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override;
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+  int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) override;
+  int16_t width(void) override { return Layout::DISPLAY_WIDTH; }
+  int16_t height(void) override { return Layout::DISPLAY_HEIGHT; }
+
+private:
+  enum Op : uint8_t { OP_PIXEL = 1, OP_LINE, OP_VLINE, OP_HLINE, OP_FILL, OP_CHAR };
+
+  void record(Op op, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color,
+              uint32_t extra, uint32_t background = 0);
+
+  DisplayList* target = nullptr;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              VERGLEICH
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Vergleicht zwei Listen segmentweise Befehl für Befehl und markiert alte und
+// neue Hülle jedes abweichenden Befehls als dirty. Rückgabe: Anzahl
+// abweichender Befehle, -1 wenn die Listen nicht vergleichbar sind
+// (Überlauf oder andere Segmentanzahl).
+int diffDisplayLists(const DisplayList& previous, const DisplayList& current, RenderManager& manager);
+
+// Statistik
+struct DisplayListStats {
+  unsigned long recordings = 0;        // aufgezeichnete Frames
+  unsigned long diffedRedraws = 0;     // Vollbild-Anfragen per Diff erledigt
+  unsigned long unchangedRedraws = 0;  // davon ohne jede Änderung
+  unsigned long fullRedraws = 0;       // Vollbild nötig (neuer Screen, Überlauf, große Änderung)
+  unsigned long overflows = 0;
+  int maxCommands = 0;
+};
+
+extern DisplayListStats displayListStats;
+
+#endif // DISPLAY_LIST_H
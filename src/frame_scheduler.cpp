@@ -0,0 +1,42 @@
+#include "frame_scheduler.h"
+
+FrameSchedulerStats frameSchedulerStats;
+
+static TaskHandle_t loopTaskHandle = nullptr;
+
+void initFrameScheduler() {
+  loopTaskHandle = xTaskGetCurrentTaskHandle();
+}
+
+void wakeFrameScheduler() {
+  if (loopTaskHandle != nullptr) xTaskNotifyGive(loopTaskHandle);
+}
+
+void IRAM_ATTR wakeFrameSchedulerFromISR() {
+  if (loopTaskHandle == nullptr) return;
+  BaseType_t higherPriorityWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(loopTaskHandle, &higherPriorityWoken);
+  frameSchedulerStats.touchWakeups++;
+  if (higherPriorityWoken) portYIELD_FROM_ISR();
+}
+
+void waitForWork(unsigned long maxWaitMs) {
+  frameSchedulerStats.wakeups++;
+
+  if (!FrameSchedulerConfig::ENABLED || loopTaskHandle == nullptr) {
+    delay(FrameSchedulerConfig::POLL_MS);
+    return;
+  }
+  if (maxWaitMs == 0) {
+    // Arbeit steht an: nur anderen Tasks auf Core 1 Luft lassen
+    ulTaskNotifyTake(pdTRUE, 0);
+    yield();
+    return;
+  }
+
+  unsigned long start = millis();
+  if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(maxWaitMs)) > 0) {
+    frameSchedulerStats.eventWakeups++;
+  }
+  frameSchedulerStats.sleptMs += millis() - start;
+}
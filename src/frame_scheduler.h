@@ -0,0 +1,56 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              FRAME-SCHEDULER
+// ═══════════════════════════════════════════════════════════════════════════════
+// loop() pollt nicht mehr im 50-ms-Takt, sondern schläft bis zur nächsten
+// fälligen Arbeit: Start des geplanten Frames (Deadline aus dem
+// RenderManager minus Zeichenzeit), periodische Jobs oder ein Weckereignis.
+// Geweckt wird über die Task-Notification des loop-Tasks:
+//   - Touch-Interrupt (CST820 INT bzw. XPT2046 IRQ)
+//   - Daten am MQTT-Socket (Watcher-Task in network.cpp)
+// Solange ein Finger aufliegt, wird im Touch-Takt gepollt (Loslassen und
+// Long-Press erzeugen keinen Interrupt). Die Leerlauf-Obergrenze hält
+// ArduinoOTA (UDP-Einladung wird nur gepollt) und den Watchdog bedient.
+
+namespace FrameSchedulerConfig {
+  constexpr bool ENABLED = true;                // false: wie bisher delay(POLL_MS)
+  constexpr unsigned long POLL_MS = 50;
+  constexpr unsigned long TOUCH_POLL_MS = 20;   // bei aufliegendem Finger
+  constexpr unsigned long IDLE_MAX_MS = 1000;   // OTA-Einladung, Watchdog (30 s)
+  static_assert(TOUCH_POLL_MS < Timing::FRAME_DEADLINE_TOUCH, "Touch-Takt muss unter der Touch-Deadline liegen");
+}
+
+// Einmalig aus setup(): merkt sich den loop-Task als Empfänger
+void initFrameScheduler();
+
+// Weckt loop() vorzeitig (aus Tasks bzw. aus Interrupts)
+void wakeFrameScheduler();
+void wakeFrameSchedulerFromISR();
+
+// Schläft höchstens 'maxWaitMs' oder bis zum nächsten Weckereignis
+void waitForWork(unsigned long maxWaitMs);
+
+// Verbleibende Zeit bis 'due' (0 wenn fällig), nach oben auf 'limit' begrenzt
+inline unsigned long msUntil(unsigned long due, unsigned long now, unsigned long limit) {
+  long remaining = (long)(due - now);
+  if (remaining <= 0) return 0;
+  return min((unsigned long)remaining, limit);
+}
+
+// Statistik
+struct FrameSchedulerStats {
+  unsigned long wakeups = 0;          // Durchläufe von loop()
+  unsigned long eventWakeups = 0;     // vorzeitig geweckt (Touch, MQTT)
+  unsigned long touchWakeups = 0;
+  unsigned long networkWakeups = 0;
+  unsigned long sleptMs = 0;          // Summe der Schlafzeit
+};
+
+extern FrameSchedulerStats frameSchedulerStats;
+
+#endif // FRAME_SCHEDULER_H
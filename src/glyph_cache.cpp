@@ -0,0 +1,152 @@
+#include "glyph_cache.h"
+#include "render.h"
+#ifdef FONT_SUBSET
+#include "font_subset.h"
+#endif
+
+GlyphCacheStats glyphCacheStats;
+
+struct GlyphSlot {
+  uint8_t font = 0;                   // 0 = frei
+  uint16_t code = 0;
+  int16_t advance = 0;
+  bool cacheable = false;             // false: zu viele Läufe oder zu groß, per drawChar zeichnen
+  uint8_t runCount = 0;
+  uint32_t lastUsed = 0;
+  GlyphRun runs[GlyphCacheConfig::MAX_RUNS];
+};
+
+static GlyphSlot glyphSlots[GlyphCacheConfig::SLOTS];
+static uint32_t useCounter = 0;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RASTERN
+// ═══════════════════════════════════════════════════════════════════════════════
+// Das Zeichen geht per drawChar in einen 1-Bit-Sprite (TFT_eSprite rastert in
+// seinen Puffer, ohne SPI und ohne das Panel anzufassen) und wird zeilenweise
+// in Läufe zerlegt.
+
+static TFT_eSprite glyphSprite(&tft);
+
+static void rasterGlyph(GlyphSlot& slot) {
+  slot.runCount = 0;
+  slot.advance = 0;
+  slot.cacheable = false;
+
+  if (!glyphSprite.created()) {
+    glyphSprite.setColorDepth(1);
+    if (glyphSprite.createSprite(GlyphCacheConfig::CELL_WIDTH, GlyphCacheConfig::CELL_HEIGHT) == nullptr) return;
+  }
+  glyphSprite.fillSprite(TFT_BLACK);
+  glyphSprite.setTextColor(TFT_WHITE);
+  slot.advance = glyphSprite.drawChar(slot.code, 0, 0, slot.font);
+  if (slot.advance > GlyphCacheConfig::CELL_WIDTH ||
+      glyphSprite.fontHeight(slot.font) > GlyphCacheConfig::CELL_HEIGHT) {
+    return;
+  }
+
+  for (int y = 0; y < GlyphCacheConfig::CELL_HEIGHT; y++) {
+    int x = 0;
+    while (x < GlyphCacheConfig::CELL_WIDTH) {
+      if (glyphSprite.readPixel(x, y) == TFT_BLACK) {
+        x++;
+        continue;
+      }
+      int runStart = x;
+      while (x < GlyphCacheConfig::CELL_WIDTH && glyphSprite.readPixel(x, y) != TFT_BLACK) x++;
+
+      if (slot.runCount >= GlyphCacheConfig::MAX_RUNS) {
+        slot.runCount = 0;
+        return;
+      }
+      slot.runs[slot.runCount++] = {(uint8_t)runStart, (uint8_t)y, (uint8_t)(x - runStart)};
+    }
+  }
+  slot.cacheable = true;
+}
+
+// Slot für (font, code): Treffer, sonst den am längsten ungenutzten neu rastern
+static const GlyphSlot& glyphFor(uint8_t font, uint16_t code) {
+  GlyphSlot* victim = &glyphSlots[0];
+  for (GlyphSlot& slot : glyphSlots) {
+    if (slot.font == font && slot.code == code) {
+      slot.lastUsed = ++useCounter;
+      glyphCacheStats.hits++;
+      return slot;
+    }
+    if (slot.lastUsed < victim->lastUsed) victim = &slot;
+  }
+
+  if (victim->font != 0) glyphCacheStats.evictions++;
+  glyphCacheStats.misses++;
+
+  victim->font = font;
+  victim->code = code;
+  victim->lastUsed = ++useCounter;
+  rasterGlyph(*victim);
+  glyphCacheStats.maxRuns = max(glyphCacheStats.maxRuns, (int)victim->runCount);
+  return *victim;
+}
+
+#ifdef FONT_SUBSET
+static const SubsetFont* subsetFontFor(uint8_t font) {
+  for (const SubsetFont& subset : FontSubset::FONTS) {
+    if (subset.font == font) return &subset;
+  }
+  return nullptr;
+}
+
+// Zeichen aus den Flash-Tabellen; nullptr wenn nicht im Subset
+static const SubsetGlyph* subsetGlyphFor(const SubsetFont* subset, uint16_t code) {
+  if (subset == nullptr || code < 32 || code >= 32 + 96) return nullptr;
+  uint8_t entry = subset->index[code - 32];
+  return entry > 0 ? &subset->glyphs[entry - 1] : nullptr;
+}
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              ZEICHNEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static void drawRuns(TFT_eSPI& gfx, const GlyphRun* runs, int count, int32_t x, int32_t y, uint16_t color) {
+  for (int r = 0; r < count; r++) {
+    gfx.drawFastHLine(x + runs[r].x, y + runs[r].y, runs[r].length, color);
+  }
+}
+
+int16_t drawCachedString(TFT_eSPI& gfx, const char* text, int32_t x, int32_t y, uint8_t font, uint16_t color) {
+  gfx.setTextColor(color);
+  if (!GlyphCacheConfig::ENABLED || !canvasHasPixels() || (font != 2 && font != 4)) {
+    return gfx.drawString(text, x, y, font);
+  }
+
+  uint16_t length = (uint16_t)strlen(text);
+  uint16_t index = 0;
+  int32_t cursorX = x;
+#ifdef FONT_SUBSET
+  const SubsetFont* subset = subsetFontFor(font);
+#endif
+
+  while (index < length) {
+    uint16_t code = gfx.decodeUTF8((uint8_t*)text, &index, length - index);
+#ifdef FONT_SUBSET
+    const SubsetGlyph* flashGlyph = subsetGlyphFor(subset, code);
+    if (flashGlyph != nullptr) {
+      glyphCacheStats.subsetHits++;
+      drawRuns(gfx, subset->runs + flashGlyph->firstRun, flashGlyph->runCount, cursorX, y, color);
+      cursorX += flashGlyph->advance;
+      continue;
+    }
+#endif
+    const GlyphSlot& glyph = glyphFor(font, code);
+
+    if (!glyph.cacheable) {
+      glyphCacheStats.uncacheable++;
+      cursorX += gfx.drawChar(code, cursorX, y, font);
+      continue;
+    }
+    drawRuns(gfx, glyph.runs, glyph.runCount, cursorX, y, color);
+    cursorX += glyph.advance;
+  }
+  return (int16_t)(cursorX - x);
+}
@@ -0,0 +1,79 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              GLYPH-CACHE
+// ═══════════════════════════════════════════════════════════════════════════════
+// TFT_eSPI rastert Zeichen der Fonts 2 und 4 bei jedem drawString neu aus den
+// Font-Tabellen; transparenter Text in Font 2 geht dabei Pixel für Pixel über
+// drawPixel. Die Sensorwerte bestehen aber fast nur aus denselben Ziffern,
+// Einheiten und Satzzeichen. Der Cache hält pro (Font, Zeichen) die
+// vorgerasterten waagrechten Läufe samt Vorschub; ein Treffer ist eine Folge
+// von drawFastHLine-Aufrufen in der Textfarbe. Die Farbe gehört nicht zum
+// Schlüssel - die Läufe sind die Maske, gefärbt wird beim Zeichnen.
+//
+// Verdrängung nach LRU. Zeichen mit zu vielen Läufen oder größer als die
+// Raster-Zelle werden nicht gecacht und weiter über drawChar gezeichnet.
+// Während einer Display-List-Aufzeichnung (canvasHasPixels() == false) wird
+// unverändert drawString aufgerufen, damit Listen und Signaturen Zeichen
+// statt Läufe enthalten.
+//
+// Font-Subset: mit FONT_SUBSET (gesetzt von tools/font_subset.py beim
+// Gerätebuild) liegen die im UI genutzten Zeichen der Fonts 2 und 4 schon
+// zur Build-Zeit gerastert als constexpr-Tabellen im Flash. Ein solches
+// Zeichen ist ein Indexzugriff - keine LRU-Suche, kein Rastern beim ersten
+// Zeichnen, kein Slot. Nur Zeichen außerhalb des Subsets nutzen den Cache.
+
+namespace GlyphCacheConfig {
+  constexpr bool ENABLED = true;
+  constexpr int SLOTS = 32;          // Ziffern, Einheiten, Satzzeichen der Fonts 2 und 4
+  constexpr int MAX_RUNS = 64;       // je Zeichen, 3 Byte je Lauf (~6 KB gesamt)
+  constexpr int CELL_WIDTH = 32;     // Raster-Sprite (1 Bit, 128 Byte); Font 4 ist 26 Zeilen hoch
+  constexpr int CELL_HEIGHT = 32;
+}
+
+struct GlyphRun {
+  uint8_t x, y, length;               // relativ zur linken oberen Ecke der Zeichenzelle
+};
+
+// Format der erzeugten Tabellen ($BUILD_DIR/font_subset/font_subset.h)
+struct SubsetGlyph {
+  uint16_t firstRun;                  // Index in runs
+  uint8_t runCount;
+  uint8_t advance;
+};
+
+struct SubsetFont {
+  uint8_t font;
+  const uint8_t* index;               // Zeichen - 32 -> Glyph + 1, 0 = nicht im Subset
+  const SubsetGlyph* glyphs;
+  const GlyphRun* runs;
+};
+
+// Wie drawString(text, x, y, font) mit setTextColor(color) (transparent,
+// Datum oben links); Fonts außer 2 und 4 gehen direkt an TFT_eSPI.
+// Rückgabe: Breite in Pixeln.
+int16_t drawCachedString(TFT_eSPI& gfx, const char* text, int32_t x, int32_t y, uint8_t font, uint16_t color);
+
+// Statistik
+struct GlyphCacheStats {
+  unsigned long hits = 0;
+  unsigned long misses = 0;           // neu gerastert
+  unsigned long evictions = 0;
+  unsigned long uncacheable = 0;      // zu viele Läufe oder zu groß, per drawChar gezeichnet
+  unsigned long subsetHits = 0;       // aus den Flash-Tabellen (FONT_SUBSET), ohne Cache
+  int maxRuns = 0;
+
+  int hitRatePercent() const {
+    unsigned long lookups = hits + misses;
+    return lookups > 0 ? (int)(hits * 100 / lookups) : 0;
+  }
+};
+
+extern GlyphCacheStats glyphCacheStats;
+
+#endif // GLYPH_CACHE_H
@@ -14,6 +14,11 @@
 #include "utils.h"
 #include "ota.h"
 #include "touch.h"
+#include "render.h"
+#include "frame_scheduler.h"
+#include "backlight.h"
+#include "debug_hud.h"
+#include "screenshot.h"
 
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              GLOBALE OBJEKTE UND VARIABLEN
@@ -38,7 +43,7 @@ const char* const NetworkConfig::MQTT_PASS = "";
 // MQTT Topics sind als Konstanten direkt in der Struktur in config.h definiert
 
 // Hardware-Objekte
-TFT_eSPI tft = TFT_eSPI();
+ProfiledTFT tft;  // TFT_eSPI mit SPI-Byte-Zähler (profiler.h)
 WiFiClient espClient;
 PubSubClient client(espClient);
 
@@ -107,6 +112,7 @@ void updateSystemStatus();
 void handleLowMemory();
 void handleCriticalError(const char* error);
 void handleTouchEvent(const TouchEvent& event);
+unsigned long msUntilNextWork(long untilFrame);
 
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              SETUP UND MAIN LOOP
@@ -148,6 +154,13 @@ void setup() {
 
     renderManager.markFullRedrawRequired();
     updateDisplay();
+
+    // Ab hier zeichnet der Render-Task (Core 0), loop() stellt nur Anfragen
+    startRenderTask();
+
+    // loop() schläft bis zur nächsten Deadline oder einem Touch/MQTT-Ereignis
+    initFrameScheduler();
+    startMqttSocketWatch();
     
     logSystemInfo();
     logSensorStatus();
@@ -159,12 +172,16 @@ void setup() {
 
 void loop() {
   unsigned long now = millis();
+  unsigned long loopStart = micros();
+  unsigned long idleMs = FrameSchedulerConfig::IDLE_MAX_MS;
   
   try {
     // Watchdog füttern um Reset zu vermeiden
     esp_task_wdt_reset();
     
-    // OTA-Updates verarbeiten (höchste Priorität)
+    // OTA-Updates verarbeiten (höchste Priorität). Ein Upload läuft komplett
+    // in handleOTA() und zeichnet selbst, der Render-Task lässt so lange
+    // das Panel in Ruhe (isOTAInProgress()).
     handleOTA();
 
     // Touch-Init wurde bereits in setup() durchgeführt
@@ -175,82 +192,134 @@ void loop() {
     }
     client.loop();
 
-    // Prüfe zuerst ob Kalibrierung aktiv ist
-    if (touchManager.isCalibrating()) {
-      if (touchManager.updateCalibration()) {
-        // Kalibrierung hat Display geändert - force redraw
-        renderManager.markFullRedrawRequired();
+    // Ab hier werden Display-Zustand und Sensordaten verändert. Der Renderer
+    // hält die Sperre nur zum Kopieren des Zustands, nicht für den Frame;
+    // loop() hält sie nur für die Änderungen, nicht für Frame-Start, Logs
+    // und MQTT-Berichte.
+    long untilFrame;
+    bool startFrame = false;
+    unsigned long frameDeadline = 0;
+    unsigned long frameCostMs = renderTaskStats.lastFrameMicros / 1000 + 1;
+    {
+      DisplayLock stateLock;
+
+      // Prüfe zuerst ob Kalibrierung aktiv ist
+      if (touchManager.isCalibrating()) {
+        if (touchManager.updateCalibration()) {
+          // Kalibrierung hat Display geändert - force redraw
+          renderManager.markPanelOverwritten();
+        }
+      } else {
+        // Normale Touch-Events verarbeiten
+        TouchEvent touchEvent = processTouchInput();
+        if (touchEvent.type != TOUCH_NONE) {
+          handleTouchEvent(touchEvent);
+        }
       }
-    } else {
-      // Normale Touch-Events verarbeiten
-      TouchEvent touchEvent = processTouchInput();
-      if (touchEvent.type != TOUCH_NONE) {
-        handleTouchEvent(touchEvent);
+
+      // Touch-Marker deaktiviert für bessere Performance
+      // updateTouchMarkers();
+
+      // Periodische Updates
+      if (now - lastSystemUpdate >= Timing::SYSTEM_UPDATE_INTERVAL) {
+        lastSystemUpdate = now;
+        updateSystemStatus();
       }
-    }
 
-    // Touch-Marker deaktiviert für bessere Performance
-    // updateTouchMarkers();
-    
-    // Periodische Updates
-    if (now - lastSystemUpdate >= Timing::SYSTEM_UPDATE_INTERVAL) {
-      lastSystemUpdate = now;
-      updateSystemStatus();
-    }
-    
-    if (now - lastTimeoutCheck >= Timing::TIMEOUT_CHECK_INTERVAL) {
-      lastTimeoutCheck = now;
-      checkSensorTimeouts();
-    }
-    
-    // ADC-Test entfernt - war nur für Hardware-Debugging
-    
-    // Anti-Burnin Management
-    antiBurnin.update();
-    if (antiBurnin.hasOffsetChanged()) {
-      renderManager.markAntiBurninChanged();
-      // Touch-Bereiche nach Anti-Burnin-Änderung aktualisieren
-      Serial.println("🔄 Anti-Burnin-Änderung - Aktualisiere Touch-Bereiche...");
-      touchManager.updateSensorTouchAreas();
-    }
-    
-    // Auto-Return zur Hauptseite nach 10s (nur wenn nicht auf Hauptseite)
-    if (currentMode != HOME_SCREEN && lastViewChangeTime > 0) {
-      if (now - lastViewChangeTime >= 10000) {  // 10 Sekunden
-        Serial.println("⏱️ Auto-Return zur Hauptseite nach 10s");
-        currentMode = HOME_SCREEN;
-        lastViewChangeTime = 0;
-        renderManager.markFullRedrawRequired();
+      if (now - lastTimeoutCheck >= Timing::TIMEOUT_CHECK_INTERVAL) {
+        lastTimeoutCheck = now;
+        checkSensorTimeouts();
       }
-    }
 
-    // Display Updates
-    if (renderManager.needsUpdate()) {
-      updateDisplay();
-      renderManager.lastRenderUpdate = now;
-    }
+      // ADC-Test entfernt - war nur für Hardware-Debugging
+
+      // Anti-Burnin Management
+      antiBurnin.update();
+      if (antiBurnin.hasOffsetChanged()) {
+        // Touch-Bereiche lesen den Offset beim Hit-Test selbst
+        renderManager.markAntiBurninChanged();
+      }
+
+      // Auto-Return zur Hauptseite nach 10s (nur wenn nicht auf Hauptseite)
+      if (currentMode != HOME_SCREEN && lastViewChangeTime > 0) {
+        if (now - lastViewChangeTime >= 10000) {  // 10 Sekunden
+          Serial.println("⏱️ Auto-Return zur Hauptseite nach 10s");
+          currentMode = HOME_SCREEN;
+          lastViewChangeTime = 0;
+          renderManager.markFullRedrawRequired();
+        }
+      }
+
+      updateDebugHud(now);
 
+      // Display Updates: den geplanten Frame so starten, dass er bei der
+      // zuletzt gemessenen Zeichenzeit zur Deadline fertig ist
+      untilFrame = renderManager.msUntilFrame(millis(), frameCostMs);
+      if (untilFrame == 0) {
+        frameDeadline = renderManager.frameDeadline;
+        renderManager.frameDispatched();
+        startFrame = true;
+      }
 
-    // System-Überwachung
-    if (systemStatus.criticalMemoryWarning) {
-      handleLowMemory();
+      // System-Überwachung
+      if (systemStatus.criticalMemoryWarning) {
+        handleLowMemory();
+      }
     }
-    
-    // Erweiterte Performance-Berichte (alle 10 Minuten)
+
+    // Erst nach Freigabe wecken: der Render-Task kopiert den Zustand sofort
+    if (startFrame) {
+      if (!requestRender(frameDeadline)) {
+        updateDisplay();  // Kein Render-Task: synchron zeichnen
+      }
+      DisplayLock stateLock;
+      untilFrame = renderManager.msUntilFrame(millis(), frameCostMs);
+    }
+
+    // Erweiterte Performance-Berichte (alle 10 Minuten), ohne DisplayLock:
+    // Serial und MQTT dürfen den Render-Task nicht aufhalten
     static unsigned long lastReport = 0;
     if (now - lastReport >= 600000) {
       lastReport = now;
-      updateSensorPerformance();
+      {
+        DisplayLock stateLock;
+        updateSensorPerformance();
+      }
       logPerformanceStats();
+      logRenderProfile();
+      publishRenderProfile();
       logSystemHealth();
     }
+
+    idleMs = msUntilNextWork(untilFrame);
     
   } catch (const std::exception& e) {
     Serial.printf("WARNUNG - Loop-Fehler: %s\n", e.what());
     delay(1000);
   }
   
-  delay(50);
+  publishPendingScreenshot();
+  noteHudLoop(micros() - loopStart);
+  armMqttSocketWatch();
+  waitForWork(idleMs);
+}
+
+// Zeit bis zur nächsten fälligen Arbeit in loop(): geplanter Frame,
+// periodische Jobs, Touch-Polling, ungelesene MQTT-Daten. 0 = sofort weiter.
+unsigned long msUntilNextWork(long untilFrame) {
+  unsigned long now = millis();
+  unsigned long wait = FrameSchedulerConfig::IDLE_MAX_MS;
+
+  if (untilFrame >= 0) wait = min(wait, (unsigned long)untilFrame);
+  wait = msUntil(lastSystemUpdate + Timing::SYSTEM_UPDATE_INTERVAL, now, wait);
+  wait = msUntil(lastTimeoutCheck + Timing::TIMEOUT_CHECK_INTERVAL, now, wait);
+  if (currentMode != HOME_SCREEN && lastViewChangeTime > 0) {
+    wait = msUntil(lastViewChangeTime + 10000, now, wait);   // Auto-Return
+  }
+  wait = msUntilDebugHudRefresh(now, wait);
+  if (touchManager.needsPolling()) wait = min(wait, FrameSchedulerConfig::TOUCH_POLL_MS);
+  if (mqttDataPending() || (screenshotReady() && client.connected())) wait = 0;
+  return wait;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -267,10 +336,14 @@ void initializeSystem() {
 void initializeDisplay() {
   unsigned long startTime = millis();
 
+  // Init-Sequenz und Löschen an alle Panels, danach nur noch das Hauptpanel
+  beginPanelBroadcast();
   tft.init();
   tft.setRotation(1);
   tft.invertDisplay(false);
   tft.fillScreen(Colors::BG_MAIN);
+  selectPanel(PanelConfig::MAIN);
+  initBacklight();
 
   tft.setTextColor(Colors::TEXT_MAIN);
   // Überschrift entfernt auf User-Anfrage
@@ -369,6 +442,7 @@ void updateSystemStatus() {
   // Moving Average über 5 Messungen für noch glattere Werte (reduziert WiFi-Störungen)
   systemStatus.ldrValue = rawLdr;
   systemStatus.ldrValueSmoothed = (int)calculateMovingAverage(rawLdr, systemStatus.ldrValueSmoothed, 0.2f);
+  updateBacklight(systemStatus.ldrValueSmoothed, millis());
   systemStatus.uptime = (millis() - systemStartTime) / 1000;
   
   renderManager.markSystemInfoChanged();
@@ -398,6 +472,7 @@ void handleLowMemory() {
 void handleCriticalError(const char* error) {
   generateSystemReport();
 
+  PanelLock panel;
   tft.fillScreen(Colors::STATUS_RED);
   tft.setTextColor(Colors::TEXT_MAIN);
   tft.drawString("SYSTEM ERROR", 10, 10, 2);
@@ -420,6 +495,7 @@ void handleTouchEvent(const TouchEvent& event) {
   switch (event.type) {
     case TOUCH_DOWN:
       // Touch wurde gestartet
+      wakeBacklight(millis());
       if (event.sensorIndex >= 0) {
         onSensorTouched(event.sensorIndex);
       }
@@ -434,17 +510,17 @@ void handleTouchEvent(const TouchEvent& event) {
           currentMode == WALLBOX_CONSUMPTION_SCREEN ||
           currentMode == LADESTAND_SCREEN ||
           currentMode == SETTINGS_SCREEN) {
-        int backButtonX = 270 + antiBurnin.getOffsetX();
-        int backButtonY = 10 + antiBurnin.getOffsetY();
+        const WidgetLayout& backButton = WIDGETS[WIDGET_BACK_BUTTON];
+        DirtyRect backRect = backButton.at(antiBurnin.getOffsetX(), antiBurnin.getOffsetY());
 
         Serial.printf("🔍 Touch bei (%d,%d), Zurück-Button bei (%d,%d) bis (%d,%d)\n",
-                     event.point.x, event.point.y, backButtonX, backButtonY,
-                     backButtonX + 40, backButtonY + 20);
+                     event.point.x, event.point.y, backRect.x, backRect.y,
+                     backRect.right(), backRect.bottom());
 
         // Erweiterte Touch-Area für bessere Erkennung (besonders bei Touch-Kalibrierung)
         int touchMargin = 15;  // Erhöht von 10 auf 15 für bessere Erkennung
-        if (event.point.x >= (backButtonX - touchMargin) && event.point.x <= (backButtonX + 40 + touchMargin) &&
-            event.point.y >= (backButtonY - touchMargin) && event.point.y <= (backButtonY + 20 + touchMargin)) {
+        if (backButton.contains(event.point.x, event.point.y, antiBurnin.getOffsetX(),
+                                antiBurnin.getOffsetY(), touchMargin)) {
           Serial.println("✅ Zurück-Button erkannt - zurück zum Home-Screen");
           currentMode = HOME_SCREEN;
           renderManager.markFullRedrawRequired();
@@ -456,28 +532,18 @@ void handleTouchEvent(const TouchEvent& event) {
       if (currentMode == SETTINGS_SCREEN) {
         if (touchManager.isCalibrating()) {
           // Beenden-Button während Kalibrierung
-          int stopButtonX = 170 + antiBurnin.getOffsetX();
-          int stopButtonY = 90;
-          int stopButtonW = 100;
-          int stopButtonH = 30;
-
-          if (event.point.x >= stopButtonX && event.point.x <= stopButtonX + stopButtonW &&
-              event.point.y >= stopButtonY && event.point.y <= stopButtonY + stopButtonH) {
+          if (WIDGETS[WIDGET_CALIBRATION_STOP].contains(event.point.x, event.point.y,
+                                                        antiBurnin.getOffsetX(), antiBurnin.getOffsetY())) {
             touchManager.stopCalibration();
-            renderManager.markFullRedrawRequired();
+            renderManager.markPanelOverwritten();
             break;
           }
         } else {
           // Start-Button wenn nicht kalibriert
-          int calibButtonX = 10 + antiBurnin.getOffsetX();
-          int calibButtonY = 90;
-          int calibButtonW = 150;
-          int calibButtonH = 30;
-
-          if (event.point.x >= calibButtonX && event.point.x <= calibButtonX + calibButtonW &&
-              event.point.y >= calibButtonY && event.point.y <= calibButtonY + calibButtonH) {
+          if (WIDGETS[WIDGET_CALIBRATION_START].contains(event.point.x, event.point.y,
+                                                         antiBurnin.getOffsetX(), antiBurnin.getOffsetY())) {
             touchManager.startCalibration();
-            renderManager.markFullRedrawRequired();
+            renderManager.markPanelOverwritten();
             break;
           }
         }
@@ -516,14 +582,10 @@ void handleTouchEvent(const TouchEvent& event) {
       }
 
       // Prüfe freie Ecke (Position [2,2]) für Settings
-      if (currentMode == HOME_SCREEN) {
-        int settingsX = 220 + antiBurnin.getOffsetX();
-        int settingsY = 135;
-        int settingsW = Layout::SENSOR_BOX_WIDTH;
-        int settingsH = Layout::SENSOR_BOX_HEIGHT;
-
-        if (event.point.x >= settingsX && event.point.x <= settingsX + settingsW &&
-            event.point.y >= settingsY && event.point.y <= settingsY + settingsH) {
+      // (nicht nach Long-Press: der schaltet dort das Debug-HUD)
+      if (currentMode == HOME_SCREEN && !event.afterLongPress) {
+        if (WIDGETS[WIDGET_SETTINGS].contains(event.point.x, event.point.y,
+                                              antiBurnin.getOffsetX(), antiBurnin.getOffsetY())) {
           currentMode = SETTINGS_SCREEN;
           lastViewChangeTime = millis();  // Timer für Auto-Return starten
           renderManager.markFullRedrawRequired();
@@ -555,14 +617,5 @@ void handleTouchEvent(const TouchEvent& event) {
     default:
       break;
   }
-
-  // Touch-Bereiche nach Anti-Burnin-Änderungen aktualisieren
-  static unsigned long lastTouchAreaUpdate = 0;
-  if (millis() - lastTouchAreaUpdate > 5000) {
-    if (antiBurnin.hasOffsetChanged()) {
-      touchManager.updateSensorTouchAreas();
-      lastTouchAreaUpdate = millis();
-    }
-  }
 }
 
@@ -1,5 +1,10 @@
 #include "network.h"
 #include "display.h"  // Für tft-Zugriff während WiFi-Setup
+#include "render.h"
+#include "frame_scheduler.h"
+#include "debug_hud.h"
+#include "screenshot.h"
+#include <lwip/sockets.h>
 
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              WIFI-MANAGEMENT
@@ -28,8 +33,9 @@ void connectWiFi() {
   delay(100);
   
   // Status-Anzeige auf Display (mit try-catch für Sicherheit)
-  extern TFT_eSPI tft;
+  extern ProfiledTFT tft;
   try {
+    PanelLock panel;
     tft.setTextColor(Colors::TEXT_LABEL);
     tft.drawString("WiFi verbinden...", 10, 50, 1);
   } catch (...) {
@@ -65,6 +71,7 @@ void connectWiFi() {
     Serial.printf("\nWiFi verbunden! IP: %s, RSSI: %d dBm\n", 
                  WiFi.localIP().toString().c_str(), systemStatus.wifiRSSI);
     
+    PanelLock panel;
     tft.setTextColor(Colors::STATUS_GREEN);
     tft.drawString("WiFi: OK", 10, 70, 1);
     tft.setTextColor(Colors::TEXT_LABEL);
@@ -74,6 +81,7 @@ void connectWiFi() {
     Serial.println("\n❌ WiFi-Verbindung fehlgeschlagen!");
     systemStatus.hasNetworkError = true;
     
+    PanelLock panel;
     tft.setTextColor(Colors::SYSTEM_ERROR);
     tft.drawString("WiFi: FEHLER", 10, 70, 1);
   }
@@ -161,10 +169,11 @@ void reconnectMQTT() {
       NetworkConfig::LOAD_POWER,
       NetworkConfig::STORAGE_POWER,
       NetworkConfig::WALLBOX_POWER,
-      NetworkConfig::ENERGY_MARKET_PRICE_DAY_AHEAD
+      NetworkConfig::ENERGY_MARKET_PRICE_DAY_AHEAD,
+      NetworkConfig::SCREENSHOT_REQUEST
     };
 
-    for (int i = 0; i < 9; i++) {
+    for (int i = 0; i < (int)(sizeof(specialTopics) / sizeof(specialTopics[0])); i++) {
       if (client.subscribe(specialTopics[i])) {
         successCount++;
         Serial.printf("✓ Special: %s\n", specialTopics[i]);
@@ -178,6 +187,7 @@ void reconnectMQTT() {
     }
     
     Serial.printf("📝 %d Topics erfolgreich abonniert\n", successCount);
+    DisplayLock lock;
     renderManager.markNetworkStatusChanged();
     
   } else {
@@ -232,11 +242,129 @@ void onMqttMessage(char* topic, byte* payload, unsigned int length) {
   message[length] = '\0';
   
   Serial.printf("MQTT: %s = %s\n", topic, message);
+  noteHudMqttMessage();
 
-
+  // Sensordaten nicht ändern, während der Renderer sie kopiert
+  DisplayLock lock;
   processMqttMessage(topic, String(message));
 }
 
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              MQTT-SOCKET-WÄCHTER
+// ═══════════════════════════════════════════════════════════════════════════════
+// PubSubClient liest nur in client.loop(). Damit loop() trotzdem schlafen kann,
+// blockiert ein kleiner Task per select() auf dem Socket und weckt loop(), wenn
+// Daten anliegen. Danach wartet er, bis loop() sie abgeholt und ihn neu scharf
+// geschaltet hat - sonst meldete select() dieselben Bytes immer wieder.
+
+static TaskHandle_t mqttWatchHandle = nullptr;
+static volatile int watchedSocket = -1;
+
+static void mqttSocketWatchLoop(void* parameter) {
+  (void)parameter;
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);   // von armMqttSocketWatch()
+    int fd = watchedSocket;
+    if (fd < 0) continue;
+
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(fd, &readable);
+    struct timeval timeout = { MqttSocketWatchConfig::SELECT_TIMEOUT_S, 0 };
+    if (select(fd + 1, &readable, nullptr, nullptr, &timeout) > 0) {
+      frameSchedulerStats.networkWakeups++;
+      wakeFrameScheduler();
+    }
+  }
+}
+
+bool startMqttSocketWatch() {
+  if (mqttWatchHandle != nullptr) return true;
+
+  BaseType_t created = xTaskCreatePinnedToCore(mqttSocketWatchLoop, "mqtt-watch",
+                                               MqttSocketWatchConfig::STACK_SIZE, nullptr,
+                                               MqttSocketWatchConfig::PRIORITY, &mqttWatchHandle,
+                                               xPortGetCoreID());
+  if (created != pdPASS) {
+    mqttWatchHandle = nullptr;
+    Serial.println("WARNUNG - MQTT-Socket-Wächter nicht gestartet, loop() pollt MQTT im Leerlauf-Takt");
+    return false;
+  }
+  return true;
+}
+
+void armMqttSocketWatch() {
+  if (mqttWatchHandle == nullptr) return;
+  watchedSocket = client.connected() ? espClient.fd() : -1;
+  xTaskNotifyGive(mqttWatchHandle);
+}
+
+bool mqttDataPending() {
+  return client.connected() && espClient.available() > 0;
+}
+
+// Render-Profil: eine Nachricht pro Abschnitt (passt in den MQTT-Puffer)
+void publishRenderProfile() {
+  if (!client.connected()) return;
+
+  int published = 0;
+  for (int i = 0; i < PROFILE_SECTION_COUNT; i++) {
+    const ProfileStats& stats = renderProfile[i];
+    if (stats.calls == 0) continue;
+
+    char topic[64];
+    snprintf(topic, sizeof(topic), "%s/%s", NetworkConfig::RENDER_PROFILE,
+             profileSectionName((ProfileSection)i));
+
+    char payload[256];
+    int length = snprintf(payload, sizeof(payload),
+                          "{\"calls\":%lu,\"avg_us\":%lu,\"p95_us\":%lu,\"max_us\":%lu,\"spi_bytes\":%llu,\"hist\":[",
+                          (unsigned long)stats.calls, (unsigned long)stats.averageMicros(),
+                          (unsigned long)stats.percentileMicros(95), (unsigned long)stats.maxMicros,
+                          (unsigned long long)stats.spiBytes);
+    for (int b = 0; b < ProfilerConfig::HISTOGRAM_BUCKETS && length < (int)sizeof(payload); b++) {
+      length += snprintf(payload + length, sizeof(payload) - length, b ? ",%lu" : "%lu",
+                         (unsigned long)stats.histogram[b]);
+    }
+    if (length < (int)sizeof(payload)) {
+      snprintf(payload + length, sizeof(payload) - length, "]}");
+    }
+
+    if (client.publish(topic, payload)) published++;
+  }
+
+  Serial.printf("📊 Render-Profil veröffentlicht (%d Abschnitte)\n", published);
+}
+
+static bool writeToMqtt(const uint8_t* data, size_t length) {
+  return client.write(data, length) == length;
+}
+
+// Fertigen Screenshot ohne Zwischenpuffer aus dem Layer streamen (größer als
+// der MQTT-Puffer). Läuft ohne DisplayLock: der Renderer fasst den Layer
+// nicht an, solange er verliehen ist. Ohne Verbindung bleibt er bis nach
+// dem Reconnect liegen.
+void publishPendingScreenshot() {
+  if (!screenshotReady() || !client.connected()) return;
+
+  size_t size = screenshotMessageSize();
+  if (!client.beginPublish(NetworkConfig::SCREENSHOT, size, false)) {
+    // Nichts gesendet, also auch kein endPublish(): im nächsten Durchlauf erneut
+    if (!deferScreenshot()) {
+      Serial.printf("WARNUNG - Screenshot (%u Bytes) verworfen, Senden nicht möglich\n", (unsigned)size);
+    }
+    return;
+  }
+
+  bool published = writeScreenshotMessage(writeToMqtt);
+  published = client.endPublish() && published;
+  if (!published) {
+    Serial.printf("WARNUNG - Screenshot (%u Bytes) nicht gesendet\n", (unsigned)size);
+  }
+  releaseScreenshot(published);
+}
+
 void processMqttMessage(const char* topic, const String& message) {
   // Standard Sensor-Daten verarbeiten (außer PV/Netz und Eco-Score)
   for (int i = 0; i < System::SENSOR_COUNT; i++) {
@@ -341,6 +469,15 @@ void processMqttMessage(const char* topic, const String& message) {
     Serial.printf("History-Response: %s\n", message.c_str());
     // Note: History screen feature to be implemented in future version
 
+  } else if (strcmp(topic, NetworkConfig::SCREENSHOT_REQUEST) == 0) {
+    if (message == "stream") {
+      setScreenshotStream(true);
+    } else if (message == "stop") {
+      setScreenshotStream(false);
+    } else {
+      requestScreenshot();
+    }
+
   } else if (strcmp(topic, NetworkConfig::ENERGY_MARKET_PRICE_DAY_AHEAD) == 0) {
     processDayAheadPriceData(message);
 
@@ -704,7 +841,7 @@ void processDayAheadPriceData(const String& message) {
     if (currentMode == DAYAHEAD_SCREEN &&
         (now - lastDisplayUpdate) > 30000) { // 30 Sekunden Mindestabstand
       extern RenderManager renderManager;
-      renderManager.markFullRedrawRequired();
+      renderManager.markFullRedrawRequired(Timing::FRAME_DEADLINE_TELEMETRY);
       lastDisplayUpdate = now;
       Serial.println("🔄 Day-Ahead Display Update (rate-limited)");
     }
@@ -59,6 +59,20 @@ bool checkWifiConnection();
 void reconnectMQTT();
 void onMqttMessage(char* topic, byte* payload, unsigned int length);
 void processMqttMessage(const char* topic, const String& message);
+void publishRenderProfile();
+void publishPendingScreenshot();   // aus loop(), außerhalb des DisplayLock
+
+// MQTT-Socket-Wächter: weckt loop() (Frame-Scheduler), sobald am MQTT-Socket
+// Daten anliegen. loop() schaltet ihn vor jedem Schlafen neu scharf.
+namespace MqttSocketWatchConfig {
+  constexpr uint32_t STACK_SIZE = 2048;
+  constexpr UBaseType_t PRIORITY = 1;
+  constexpr int SELECT_TIMEOUT_S = 5;    // danach neuen Socket (Reconnect) übernehmen
+}
+
+bool startMqttSocketWatch();
+void armMqttSocketWatch();
+bool mqttDataPending();                  // noch ungelesene Bytes (WiFiClient-Puffer)
 
 // Sensor-Datenverarbeitung (aus MQTT)
 void updateSensorValue(int index, float newValue);
@@ -1,5 +1,6 @@
 #include "ota.h"
 #include "display.h"
+#include "render.h"
 
 // Globale OTA-Status Variable
 OTAStatus otaStatus;
@@ -37,6 +38,8 @@ void initializeOTA() {
   otaStatus.isActive = true;
 }
 
+// Läuft ohne DisplayLock: die Callbacks sperren nur, solange sie otaStatus
+// ändern (der Renderer kopiert den Status), und zeichnen unter PanelLock
 void handleOTA() {
   if (!otaStatus.isActive) return;
   
@@ -47,9 +50,10 @@ void handleOTA() {
     unsigned long now = millis();
     if (now - otaStatus.lastActivity > 30000) { // 30 Sekunden Timeout
       Serial.println("WARNUNG - OTA-Timeout erkannt");
+      DisplayLock lock;
       otaStatus.lastError = "Update-Timeout";
       otaStatus.isInProgress = false;
-      renderManager.markFullRedrawRequired(); // Display neu zeichnen
+      renderManager.markPanelOverwritten(); // Display neu zeichnen
     }
   }
 }
@@ -62,6 +66,10 @@ bool isOTAActive() {
   return otaStatus.isActive;
 }
 
+bool isOTAInProgress() {
+  return otaStatus.isInProgress;
+}
+
 int getOTAProgress() {
   return otaStatus.progress;
 }
@@ -82,12 +90,15 @@ void onOTAStart() {
   
   Serial.printf("🚀 OTA-Update gestartet: %s\n", type.c_str());
   
-  otaStatus.isInProgress = true;
-  otaStatus.startTime = millis();
-  otaStatus.progress = 0;
-  otaStatus.currentOperation = "Update: " + type;
-  otaStatus.lastError = "";
-  otaStatus.lastActivity = millis();
+  {
+    DisplayLock lock;
+    otaStatus.isInProgress = true;   // ab hier lässt der Renderer das Panel in Ruhe
+    otaStatus.startTime = millis();
+    otaStatus.progress = 0;
+    otaStatus.currentOperation = "Update: " + type;
+    otaStatus.lastError = "";
+    otaStatus.lastActivity = millis();
+  }
   
   // Display für OTA-Modus vorbereiten
   displayOTAProgress();
@@ -98,7 +109,10 @@ void onOTAStart() {
 void onOTAProgress(unsigned int progress, unsigned int total) {
   int percentage = (progress * 100) / total;
   
-  otaStatus.updateProgress(percentage, otaStatus.currentOperation);
+  {
+    DisplayLock lock;
+    otaStatus.updateProgress(percentage, otaStatus.currentOperation);
+  }
   
   // Alle 10% Progress loggen
   static int lastLoggedPercent = -1;
@@ -118,8 +132,11 @@ void onOTAEnd() {
   Serial.printf("OTA-Update abgeschlossen in %lu Sekunden\n", duration);
   Serial.println("🔄 Neustart in 3 Sekunden...");
   
-  otaStatus.currentOperation = "Abgeschlossen";
-  otaStatus.progress = 100;
+  {
+    DisplayLock lock;
+    otaStatus.currentOperation = "Abgeschlossen";
+    otaStatus.progress = 100;
+  }
   
   // Finales Display-Update
   displayOTAProgress();
@@ -134,16 +151,20 @@ void onOTAError(ota_error_t error) {
   
   Serial.printf("OTA-Fehler: %s\n", errorMsg.c_str());
   
-  otaStatus.lastError = errorMsg;
-  otaStatus.isInProgress = false;
-  otaStatus.currentOperation = "Fehler";
+  {
+    DisplayLock lock;
+    otaStatus.lastError = errorMsg;
+    otaStatus.currentOperation = "Fehler";
+  }
   
   // Fehler auf Display anzeigen
   displayOTAProgress();
   
   // Nach Fehler normalen Betrieb fortsetzen
   delay(5000);
-  renderManager.markFullRedrawRequired();
+  DisplayLock lock;
+  otaStatus.isInProgress = false;
+  renderManager.markPanelOverwritten();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -171,7 +192,8 @@ void logOTAStatus() {
 
 void displayOTAProgress() {
   // Ganzen Bildschirm für OTA-Anzeige verwenden
-  extern TFT_eSPI tft;
+  extern ProfiledTFT tft;
+  PanelLock panel;
   
   tft.fillScreen(Colors::BG_MAIN);
   
@@ -71,6 +71,7 @@ void handleOTA();
 
 // Status und Überwachung
 bool isOTAActive();
+bool isOTAInProgress();    // Upload läuft: das Panel zeigt den OTA-Bildschirm
 int getOTAProgress();
 String getOTAStatus();
 
@@ -0,0 +1,129 @@
+#include "palette_buffer.h"
+
+PaletteBuffer::PaletteBuffer(uint8_t* storage, size_t capacity) : pixels(storage), capacity(capacity) {
+  clear();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              AUFNAHME
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void PaletteBuffer::clear() {
+  paletteCount = 0;
+  lastIndex = -1;
+  bufferArea = DirtyRect();
+  rowBytes = 0;
+  capturedRows = 0;
+  overflow = false;
+  valid = false;
+  bufferKey = 0;
+}
+
+bool PaletteBuffer::beginCapture(const DirtyRect& area, uint32_t key) {
+  clear();
+  if (area.isEmpty()) return false;
+
+  if ((size_t)area.w * area.h <= capacity) {
+    depth = 8;
+  } else if ((size_t)(area.w + 1) / 2 * area.h <= capacity) {
+    depth = 4;
+  } else {
+    return false;
+  }
+
+  bufferArea = area;
+  rowBytes = (area.w * depth + 7) / 8;
+  bufferKey = key;
+  return true;
+}
+
+// Index der Farbe in der Palette, neu aufgenommen falls nötig; -1 wenn voll
+int PaletteBuffer::paletteIndex(uint16_t color) {
+  if (lastIndex >= 0 && palette[lastIndex] == color) return lastIndex;
+
+  for (int i = 0; i < paletteCount; i++) {
+    if (palette[i] == color) return lastIndex = i;
+  }
+  if (paletteCount >= (1 << depth)) return -1;
+  palette[paletteCount] = color;
+  return lastIndex = paletteCount++;
+}
+
+void PaletteBuffer::captureFrom(TFT_eSprite& sprite, int32_t originX, int32_t originY) {
+  if (overflow || rowBytes == 0) return;
+  if (sprite.getColorDepth() != 16) {
+    overflow = true;
+    return;
+  }
+
+  // Nächste fehlende Zeile muss im Sprite liegen, Spalten vollständig
+  int y = bufferArea.y + capturedRows;
+  int y1 = min(bufferArea.bottom(), (int)(originY + sprite.height()));
+  if (y < originY || y >= y1) return;
+  if (bufferArea.x < originX || bufferArea.right() > originX + sprite.width()) {
+    overflow = true;
+    return;
+  }
+
+  const uint16_t* source = (const uint16_t*)sprite.getPointer();
+  int stride = sprite.width();
+
+  for (; y < y1; y++) {
+    const uint16_t* line = source + (y - originY) * stride + (bufferArea.x - originX);
+    uint8_t* out = pixels + (size_t)(y - bufferArea.y) * rowBytes;
+
+    for (int x = 0; x < bufferArea.w; x++) {
+      int index = paletteIndex(line[x]);
+      if (index < 0) {
+        overflow = true;
+        return;
+      }
+      if (depth == 8) {
+        out[x] = (uint8_t)index;
+      } else if (x & 1) {
+        out[x >> 1] = (out[x >> 1] & 0xF0) | index;
+      } else {
+        out[x >> 1] = (uint8_t)(index << 4);
+      }
+    }
+    capturedRows++;
+  }
+}
+
+bool PaletteBuffer::finishCapture() {
+  valid = !overflow && rowBytes > 0 && capturedRows == bufferArea.h;
+  captures++;
+  maxColors = max(maxColors, paletteCount);
+  if (overflow) overflows++;
+  return valid;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              AUSGABE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void PaletteBuffer::copyTo(TFT_eSprite& sprite, int32_t originX, int32_t originY) const {
+  if (!valid || sprite.getColorDepth() != 16) return;
+
+  // Auf den Sprite beschneiden
+  int x0 = max((int)bufferArea.x, (int)originX);
+  int y0 = max((int)bufferArea.y, (int)originY);
+  int x1 = min(bufferArea.right(), (int)(originX + sprite.width()));
+  int y1 = min(bufferArea.bottom(), (int)(originY + sprite.height()));
+  if (x1 <= x0 || y1 <= y0) return;
+
+  uint16_t* target = (uint16_t*)sprite.getPointer();
+  int stride = sprite.width();
+
+  for (int y = y0; y < y1; y++) {
+    const uint8_t* in = pixels + (size_t)(y - bufferArea.y) * rowBytes;
+    uint16_t* out = target + (y - originY) * stride - originX;
+
+    for (int x = x0; x < x1; x++) {
+      int column = x - bufferArea.x;
+      uint8_t index = depth == 8 ? in[column]
+                                 : (column & 1) ? (in[column >> 1] & 0x0F) : (in[column >> 1] >> 4);
+      out[x] = palette[index];
+    }
+  }
+}
@@ -0,0 +1,81 @@
+#ifndef PALETTE_BUFFER_H
+#define PALETTE_BUFFER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              PALETTEN-PUFFER (4/8 BIT)
+// ═══════════════════════════════════════════════════════════════════════════════
+// Rechteckiger Bildausschnitt als Farbindizes: 8 Bit je Pixel (bis 256 Farben)
+// oder 4 Bit (bis 16 Farben), Palette in RGB565 (Sprite-Byte-Reihenfolge).
+// Erst beim Übertragen wird in den 16-Bit-Band-Sprite zurück expandiert.
+// Das UI nutzt nur wenige feste Farben (Colors in config.h, einige TFT_*),
+// daher ist die Umsetzung verlustfrei - mehr Farben als der Modus fasst
+// gelten als Überlauf, der Ausschnitt wird dann nicht gecacht.
+//
+// Ein Vollbild braucht so 75 KB (8 Bit) bzw. 38 KB (4 Bit) statt 150 KB.
+// Genutzt für die Chart-Layer der Detail-Screens (display.cpp).
+
+namespace PaletteBufferConfig {
+  constexpr bool ENABLED = true;
+  constexpr size_t DETAIL_CACHE_BYTES = 32768;   // Ökostrom-Chart 320x98 @ 8 Bit, Preis-Body 320x155 @ 4 Bit
+  constexpr int MAX_COLORS = 256;
+}
+
+class PaletteBuffer {
+public:
+  // Pixel-Speicher wird vom Aufrufer gestellt (statisches Array)
+  PaletteBuffer(uint8_t* storage, size_t capacity);
+
+  void clear();
+  bool isValid() const { return valid; }
+  bool matches(uint32_t key) const { return valid && bufferKey == key; }
+  const DirtyRect& area() const { return bufferArea; }
+  int bitsPerPixel() const { return depth; }
+  size_t bytesUsed() const { return (size_t)rowBytes * bufferArea.h; }
+
+  // Aufnahme von 'area' (absolute Panel-Koordinaten): 8 Bit wenn der
+  // Ausschnitt so in den Speicher passt, sonst 4 Bit. false wenn auch
+  // 4 Bit nicht passen.
+  bool beginCapture(const DirtyRect& area, uint32_t key);
+
+  // Übernimmt die nächsten Zeilen von 'area' aus einem 16-Bit-Sprite, dessen
+  // linke obere Ecke bei (originX, originY) liegt. Zeilen müssen in
+  // Reihenfolge kommen (Bänder von oben nach unten).
+  void captureFrom(TFT_eSprite& sprite, int32_t originX, int32_t originY);
+
+  // false bei Überlauf (zu viele Farben) oder unvollständiger Aufnahme
+  bool finishCapture();
+
+  // Expandiert den Teil des Ausschnitts, der im Sprite liegt, nach RGB565
+  void copyTo(TFT_eSprite& sprite, int32_t originX, int32_t originY) const;
+
+  // Statistik
+  unsigned long captures = 0;
+  unsigned long overflows = 0;
+  unsigned long restores = 0;
+  int maxColors = 0;
+
+private:
+  int paletteIndex(uint16_t color);
+
+  uint8_t* pixels;
+  size_t capacity;
+  uint16_t palette[PaletteBufferConfig::MAX_COLORS];
+  int paletteCount = 0;
+  int lastIndex = -1;                 // letzte Farbe (Flächen wiederholen sie)
+  DirtyRect bufferArea;
+  int depth = 8;
+  int rowBytes = 0;
+  int capturedRows = 0;
+  bool overflow = false;
+  bool valid = false;
+  uint32_t bufferKey = 0;
+};
+
+// Cache für den Chart-Layer der Detail-Screens (definiert in display.cpp)
+extern PaletteBuffer detailLayerCache;
+
+#endif // PALETTE_BUFFER_H
@@ -0,0 +1,156 @@
+#include "profiler.h"
+#include "render.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              STATISTIK
+// ═══════════════════════════════════════════════════════════════════════════════
+
+ProfileStats renderProfile[PROFILE_SECTION_COUNT];
+
+static const char* const PROFILE_SECTION_NAMES[PROFILE_SECTION_COUNT] = {
+  "frame",
+  "sensor_box",
+  "consumption_bar",
+  "bidirectional_bar",
+  "pv_distribution_bar",
+  "time_display",
+  "system_info",
+  "network_status",
+  "price_chart",
+  "simple_price_chart",
+  "oekostrom_chart"
+};
+
+const char* profileSectionName(ProfileSection section) {
+  return section < PROFILE_SECTION_COUNT ? PROFILE_SECTION_NAMES[section] : "?";
+}
+
+void resetRenderProfile() {
+  for (int i = 0; i < PROFILE_SECTION_COUNT; i++) {
+    renderProfile[i] = ProfileStats();
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              PANEL MIT SPI-BYTE-ZÄHLER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+DirtyRect ProfiledTFT::visibleArea(int32_t x, int32_t y, int32_t w, int32_t h) const {
+  if (_vpOoB) return DirtyRect();
+
+  // Wie in TFT_eSPI: Datum verschieben, dann auf den Viewport clippen
+  int32_t x0 = max(x + _xDatum, _vpX);
+  int32_t y0 = max(y + _yDatum, _vpY);
+  int32_t x1 = min(x + _xDatum + w, _vpW);
+  int32_t y1 = min(y + _yDatum + h, _vpH);
+  if (x1 <= x0 || y1 <= y0) return DirtyRect();
+
+  return DirtyRect(x0, y0, x1 - x0, y1 - y0);
+}
+
+void ProfiledTFT::accountArea(const DirtyRect& area) {
+  if (area.isEmpty()) return;
+  spiBytes += ProfilerConfig::WINDOW_SETUP_BYTES + (uint32_t)area.area() * ProfilerConfig::BYTES_PER_PIXEL;
+  notePanelWrite(area);
+}
+
+void ProfiledTFT::touchBlock(int32_t x, int32_t y, int32_t w, int32_t h) {
+  DirtyRect area = visibleArea(x, y, w, h);
+  accountArea(area);
+  invalidatePanelTiles(area);
+}
+
+void ProfiledTFT::pushSpriteClipped(TFT_eSprite& sprite, int32_t x, int32_t y, const DirtyRect& clip) {
+  // Viewport-Zustand sichern (TFT_eSPI bietet dafür keine API)
+  int32_t vpX = _vpX, vpY = _vpY, vpW = _vpW, vpH = _vpH;
+  int32_t xDatum = _xDatum, yDatum = _yDatum, xWidth = _xWidth, yHeight = _yHeight;
+  bool vpDatum = _vpDatum, vpOoB = _vpOoB;
+
+  // Clip-Fenster ohne Datum: Sprite-Position ebenfalls absolut angeben
+  setViewport(clip.x, clip.y, clip.w, clip.h, false);
+  sprite.pushSprite(x + xDatum, y + yDatum);
+
+  _vpX = vpX; _vpY = vpY; _vpW = vpW; _vpH = vpH;
+  _xDatum = xDatum; _yDatum = yDatum; _xWidth = xWidth; _yHeight = yHeight;
+  _vpDatum = vpDatum; _vpOoB = vpOoB;
+}
+
+void ProfiledTFT::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  touchBlock(x, y, 1, 1);
+  TFT_eSPI::drawPixel(x, y, color);
+}
+
+void ProfiledTFT::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  touchBlock(x, y, 1, h);
+  TFT_eSPI::drawFastVLine(x, y, h, color);
+}
+
+void ProfiledTFT::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  touchBlock(x, y, w, 1);
+  TFT_eSPI::drawFastHLine(x, y, w, color);
+}
+
+void ProfiledTFT::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  touchBlock(x, y, w, h);
+  TFT_eSPI::fillRect(x, y, w, h, color);
+}
+
+int16_t ProfiledTFT::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+  // Text mit Hintergrundfarbe schreibt TFT_eSPI ohne die Primitive direkt
+  // ins Panel-Fenster - Bytes zählen dann nicht, die Kacheln aber schon
+  int16_t advance = TFT_eSPI::drawChar(uniCode, x, y, font);
+  DirtyRect area = visibleArea(x, y, advance, fontHeight(font));
+  invalidatePanelTiles(area);
+  notePanelWrite(area);
+  return advance;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              MESS-SCOPE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+ProfileScope::ProfileScope(ProfileSection section)
+  : section(section), startMicros(0), startBytes(0) {
+  if (!ProfilerConfig::ENABLED) return;
+  startMicros = micros();
+  startBytes = tft.bytesPushed();
+}
+
+ProfileScope::~ProfileScope() {
+  if (!ProfilerConfig::ENABLED) return;
+  renderProfile[section].record(micros() - startMicros, tft.bytesPushed() - startBytes);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              AUSGABE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void logRenderProfile() {
+  Serial.println("⏱️ RENDER-PROFIL (seit Start):");
+  Serial.println("   Abschnitt            Aufrufe   Ø us  p95 us  max us   SPI-Bytes");
+
+  for (int i = 0; i < PROFILE_SECTION_COUNT; i++) {
+    const ProfileStats& stats = renderProfile[i];
+    if (stats.calls == 0) continue;
+
+    Serial.printf("   %-20s %7lu %6lu %7lu %7lu %11llu\n",
+                  profileSectionName((ProfileSection)i),
+                  (unsigned long)stats.calls,
+                  (unsigned long)stats.averageMicros(),
+                  (unsigned long)stats.percentileMicros(95),
+                  (unsigned long)stats.maxMicros,
+                  (unsigned long long)stats.spiBytes);
+  }
+
+  // Histogramm nur für den Gesamt-Frame (Buckets als obere Grenze in us)
+  const ProfileStats& frame = renderProfile[PROFILE_FRAME];
+  if (frame.calls > 0) {
+    Serial.print("   Frame-Histogramm:");
+    for (int b = 0; b < ProfilerConfig::HISTOGRAM_BUCKETS; b++) {
+      if (frame.histogram[b] > 0) {
+        Serial.printf(" <%lu:%lu", 2UL << b, (unsigned long)frame.histogram[b]);
+      }
+    }
+    Serial.println();
+  }
+}
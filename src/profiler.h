@@ -0,0 +1,147 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RENDER-PROFILER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Misst die Zeichenfunktionen im Hot-Path: Aufrufe, Zeit in Mikrosekunden als
+// log2-Histogramm und geschätzte SPI-Bytes. Ausgabe über Serial
+// (logRenderProfile) und MQTT (publishRenderProfile in network.cpp).
+
+namespace ProfilerConfig {
+  constexpr bool ENABLED = true;
+  constexpr int HISTOGRAM_BUCKETS = 16;     // Bucket b: [2^b, 2^(b+1)) us, letzter offen
+  constexpr uint32_t WINDOW_SETUP_BYTES = 11; // CASET + RASET + RAMWR inkl. Parameter
+  constexpr uint32_t BYTES_PER_PIXEL = 2;     // RGB565
+}
+
+// Gemessene Abschnitte (Reihenfolge = Ausgabe-Reihenfolge)
+enum ProfileSection : uint8_t {
+  PROFILE_FRAME = 0,             // updateDisplay() gesamt
+  PROFILE_SENSOR_BOX,
+  PROFILE_CONSUMPTION_BAR,
+  PROFILE_BIDIRECTIONAL_BAR,
+  PROFILE_PV_DISTRIBUTION_BAR,
+  PROFILE_TIME_DISPLAY,
+  PROFILE_SYSTEM_INFO,
+  PROFILE_NETWORK_STATUS,
+  PROFILE_PRICE_CHART,
+  PROFILE_SIMPLE_PRICE_CHART,
+  PROFILE_OEKOSTROM_CHART,
+  PROFILE_SECTION_COUNT
+};
+
+struct ProfileStats {
+  uint32_t calls = 0;
+  uint64_t totalMicros = 0;
+  uint32_t maxMicros = 0;
+  uint64_t spiBytes = 0;
+  uint32_t histogram[ProfilerConfig::HISTOGRAM_BUCKETS] = {};
+
+  void record(uint32_t micros, uint32_t bytes) {
+    calls++;
+    totalMicros += micros;
+    maxMicros = max(maxMicros, micros);
+    spiBytes += bytes;
+    histogram[bucketFor(micros)]++;
+  }
+
+  uint32_t averageMicros() const {
+    return calls > 0 ? (uint32_t)(totalMicros / calls) : 0;
+  }
+
+  // Obere Bucket-Grenze, unter der 'percent' % der Aufrufe liegen (max. maxMicros)
+  uint32_t percentileMicros(int percent) const {
+    uint32_t threshold = (uint32_t)(((uint64_t)calls * percent + 99) / 100);
+    uint32_t seen = 0;
+    for (int b = 0; b < ProfilerConfig::HISTOGRAM_BUCKETS; b++) {
+      seen += histogram[b];
+      if (seen >= threshold && seen > 0) return min((uint32_t)(2UL << b), maxMicros);
+    }
+    return maxMicros;
+  }
+
+  static int bucketFor(uint32_t micros) {
+    int bucket = 0;
+    while (micros > 1 && bucket < ProfilerConfig::HISTOGRAM_BUCKETS - 1) {
+      micros >>= 1;
+      bucket++;
+    }
+    return bucket;
+  }
+};
+
+extern ProfileStats renderProfile[PROFILE_SECTION_COUNT];
+const char* profileSectionName(ProfileSection section);
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              PANEL MIT SPI-BYTE-ZÄHLER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Überschreibt die virtuellen Primitive von TFT_eSPI und schätzt pro Aufruf
+// die gesendeten Bytes (Fenster-Setup + 2 Byte je sichtbarem Pixel, geclippt
+// auf den Viewport). Zusammengesetzte Formen und Text laufen über diese
+// Primitive; Sprite-Pushes meldet pushSpriteToPanel() per accountArea().
+// Jeder direkte Zeichenbefehl macht außerdem die Kacheln des Kachel-Caches
+// (render.h) im getroffenen Bereich ungültig.
+
+class ProfiledTFT : public TFT_eSPI {
+public:
+  ProfiledTFT() : TFT_eSPI() {}
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+  using TFT_eSPI::drawChar;
+  int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) override;
+
+  // Sichtbarer Teil eines Blocks (relativ zum Viewport-Datum) in absoluten
+  // Panel-Koordinaten, geclippt auf den Viewport; leer wenn unsichtbar
+  DirtyRect visibleArea(int32_t x, int32_t y, int32_t w, int32_t h) const;
+
+  // Bereich in absoluten Panel-Koordinaten verbuchen
+  void accountArea(const DirtyRect& area);
+  uint32_t bytesPushed() const { return spiBytes; }
+
+  // Überträgt nur den Teil 'clip' (absolut, innerhalb des Viewports) eines
+  // Sprites an (x, y) synchron; der Viewport wird danach wiederhergestellt
+  void pushSpriteClipped(TFT_eSprite& sprite, int32_t x, int32_t y, const DirtyRect& clip);
+
+private:
+  // Direkter Zeichenbefehl: Bytes verbuchen, Kacheln ungültig machen
+  void touchBlock(int32_t x, int32_t y, int32_t w, int32_t h);
+
+  uint32_t spiBytes = 0;
+};
+
+// Das Panel (definiert in main.cpp)
+extern ProfiledTFT tft;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              MESS-SCOPE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Misst vom Konstruktor bis zum Destruktor (verschachtelte Scopes zählen inklusiv)
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfileSection section);
+  ~ProfileScope();
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+  ProfileSection section;
+  uint32_t startMicros;
+  uint32_t startBytes;
+};
+
+// Ausgabe
+void logRenderProfile();
+void resetRenderProfile();
+
+#endif // PROFILER_H
@@ -0,0 +1,667 @@
+#include "render.h"
+#include "display.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              ZEICHENZIEL
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static TFT_eSPI* activeCanvas = nullptr;
+static bool activeCanvasPixels = true;
+
+TFT_eSPI& canvas() {
+  return activeCanvas ? *activeCanvas : tft;
+}
+
+bool canvasHasPixels() {
+  return activeCanvasPixels;
+}
+
+CanvasScope::CanvasScope(TFT_eSPI& target, bool pixels)
+    : previous(activeCanvas), previousPixels(activeCanvasPixels) {
+  activeCanvas = &target;
+  activeCanvasPixels = pixels;
+}
+
+CanvasScope::~CanvasScope() {
+  activeCanvas = previous;
+  activeCanvasPixels = previousPixels;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              SPRITE-PUFFER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+SpriteRenderStats spriteRenderStats;
+RenderTaskStats renderTaskStats;
+FrameBudgetStats frameBudgetStats;
+PanelStats panelStats;
+
+// Zwei Puffer für Ping-Pong: während einer per DMA läuft, wird der andere gefüllt
+static TFT_eSprite sensorBoxSprite(&tft);
+static TFT_eSprite sensorBoxSpriteAlt(&tft);
+static bool altSpriteFailed = false;
+static bool useAltSprite = false;
+
+// true sobald der Render-Task DMA initialisiert hat
+static bool panelDmaActive = false;
+
+// Holt PanelLock und SPI-Transaktion für den laufenden Frame zurück (RENDER-TASK)
+static void claimFramePanel();
+
+static bool createSensorBoxSprite(TFT_eSprite& sprite) {
+  sprite.setColorDepth(16);
+  sprite.setAttribute(PSRAM_ENABLE, false);  // DMA kann nur aus internem RAM lesen
+  return sprite.createSprite(Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT) != nullptr;
+}
+
+TFT_eSprite* acquireSensorBoxSprite(int width, int height) {
+  if (width != Layout::SENSOR_BOX_WIDTH || height != Layout::SENSOR_BOX_HEIGHT) {
+    return nullptr;
+  }
+
+  if (!sensorBoxSprite.created()) {
+    // Nach einem Fehlschlag nicht bei jedem Frame erneut versuchen
+    if (spriteRenderStats.allocationFailed) return nullptr;
+
+    if (!createSensorBoxSprite(sensorBoxSprite)) {
+      spriteRenderStats.allocationFailed = true;
+      Serial.println("WARNUNG - Sensor-Box-Sprite konnte nicht angelegt werden, zeichne direkt");
+      return nullptr;
+    }
+    Serial.printf("Sensor-Box-Sprite angelegt (%dx%d, %d Bytes)\n",
+                  Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT,
+                  Layout::SENSOR_BOX_WIDTH * Layout::SENSOR_BOX_HEIGHT * 2);
+  }
+
+  if (!panelDmaActive) return &sensorBoxSprite;
+
+  if (!sensorBoxSpriteAlt.created() && !altSpriteFailed) {
+    altSpriteFailed = !createSensorBoxSprite(sensorBoxSpriteAlt);
+    if (altSpriteFailed) {
+      Serial.println("WARNUNG - Zweiter Sensor-Box-Sprite fehlt, DMA ohne Ping-Pong");
+    }
+  }
+
+  if (altSpriteFailed) {
+    // Einziger Puffer darf erst nach Ende der Übertragung neu gefüllt werden
+    finishPanelDMA();
+    return &sensorBoxSprite;
+  }
+
+  // pushImageDMA wartet vor dem Start auf die vorherige Übertragung, daher ist
+  // der jeweils andere Puffer beim nächsten Zugriff immer frei
+  useAltSprite = !useAltSprite;
+  return useAltSprite ? &sensorBoxSpriteAlt : &sensorBoxSprite;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              MEHRERE PANELS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+#if PANEL_COUNT > 1 && defined(TFT_CS) && TFT_CS >= 0
+#error "Mehrere Panels: TFT_CS=-1 setzen, die CS-Pins schaltet render.cpp"
+#endif
+#if PANEL_COUNT == 1 && defined(TFT_CS) && TFT_CS >= 0 && TFT_CS != PANEL_CS_MAIN
+#error "PANEL_CS_MAIN muss bei einem Panel TFT_CS entsprechen"
+#endif
+
+static int selectedPanel = PanelConfig::MAIN;   // -1 = alle (Init)
+
+static void setChipSelect(int panel, bool active) {
+  digitalWrite(PanelConfig::CS_PINS[panel], active ? LOW : HIGH);
+}
+
+void beginPanelBroadcast() {
+  // Ein Panel: CS bleibt bei TFT_eSPI
+  if (PanelConfig::COUNT == 1) return;
+  for (int panel = 0; panel < PanelConfig::COUNT; panel++) {
+    pinMode(PanelConfig::CS_PINS[panel], OUTPUT);
+    setChipSelect(panel, true);
+  }
+  selectedPanel = -1;
+}
+
+void selectPanel(int panel) {
+  if (PanelConfig::COUNT == 1 || panel == selectedPanel) return;
+  if (panel < 0 || panel >= PanelConfig::COUNT) return;
+
+  // CS darf während einer Übertragung nicht wechseln
+  finishPanelDMA();
+  for (int other = 0; other < PanelConfig::COUNT; other++) {
+    setChipSelect(other, other == panel);
+  }
+  selectedPanel = panel;
+  panelStats.panelSwitches++;
+}
+
+int activePanel() {
+  return selectedPanel < 0 ? PanelConfig::MAIN : selectedPanel;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              KACHEL-CACHE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+constexpr int TILE_COUNT = TileCacheConfig::COLUMNS * TileCacheConfig::ROWS;
+constexpr uint32_t TILE_UNKNOWN = 0;
+
+static uint32_t tileHashes[PanelConfig::COUNT][TILE_COUNT];   // 0 = Inhalt unbekannt
+static bool tileChanged[TILE_COUNT];
+
+static DirtyRect tileRect(int column, int row) {
+  return DirtyRect(column * TileCacheConfig::TILE_WIDTH, row * TileCacheConfig::TILE_HEIGHT,
+                   TileCacheConfig::TILE_WIDTH, TileCacheConfig::TILE_HEIGHT);
+}
+
+// Kachelspalten/-zeilen, die ein (nicht leerer) Bereich berührt
+static int firstTileColumn(const DirtyRect& area) { return area.x / TileCacheConfig::TILE_WIDTH; }
+static int lastTileColumn(const DirtyRect& area) { return (area.right() - 1) / TileCacheConfig::TILE_WIDTH; }
+static int firstTileRow(const DirtyRect& area) { return area.y / TileCacheConfig::TILE_HEIGHT; }
+static int lastTileRow(const DirtyRect& area) { return (area.bottom() - 1) / TileCacheConfig::TILE_HEIGHT; }
+
+static DirtyRect intersection(const DirtyRect& a, const DirtyRect& b) {
+  int x0 = max((int)a.x, (int)b.x), y0 = max((int)a.y, (int)b.y);
+  int x1 = min(a.right(), b.right()), y1 = min(a.bottom(), b.bottom());
+  return (x1 > x0 && y1 > y0) ? DirtyRect(x0, y0, x1 - x0, y1 - y0) : DirtyRect();
+}
+
+void invalidatePanelTiles(const DirtyRect& area) {
+  if (!TileCacheConfig::ENABLED || area.isEmpty()) return;
+  for (int row = firstTileRow(area); row <= lastTileRow(area); row++) {
+    for (int column = firstTileColumn(area); column <= lastTileColumn(area); column++) {
+      tileHashes[activePanel()][row * TileCacheConfig::COLUMNS + column] = TILE_UNKNOWN;
+    }
+  }
+}
+
+// FNV-1a über Lage und Pixel des Teilbereichs 'part' (absolut) eines Sprites,
+// dessen linke obere Ecke auf dem Panel bei (originX, originY) liegt
+static uint32_t hashSpriteArea(TFT_eSprite& sprite, int32_t originX, int32_t originY, const DirtyRect& part) {
+  uint32_t hash = 2166136261u;
+  const int16_t geometry[] = {part.x, part.y, part.w, part.h};
+  for (int16_t value : geometry) {
+    hash = (hash ^ (uint16_t)value) * 16777619u;
+  }
+
+  const uint16_t* pixels = (const uint16_t*)sprite.getPointer();
+  int stride = sprite.width();
+  for (int row = 0; row < part.h; row++) {
+    const uint16_t* line = pixels + (part.y - originY + row) * stride + (part.x - originX);
+    for (int column = 0; column < part.w; column++) {
+      hash = (hash ^ line[column]) * 16777619u;
+    }
+  }
+  return hash != TILE_UNKNOWN ? hash : 1;
+}
+
+// Vergleicht alle Kacheln im sichtbaren Bereich mit dem Cache, aktualisiert
+// ihn und markiert geänderte Kacheln in tileChanged. Rückgabe: Anzahl
+// geänderter Kacheln; 'total' erhält die Anzahl geprüfter Kacheln.
+// Ohne 'count' (Teil-Übertragungen) bleibt die Kachel-Statistik unberührt.
+static int updateTileHashes(TFT_eSprite& sprite, int32_t originX, int32_t originY,
+                            const DirtyRect& visible, int& total, bool count = true) {
+  uint32_t* hashes = tileHashes[activePanel()];
+  int changed = 0;
+  total = 0;
+  for (int row = firstTileRow(visible); row <= lastTileRow(visible); row++) {
+    for (int column = firstTileColumn(visible); column <= lastTileColumn(visible); column++) {
+      int tile = row * TileCacheConfig::COLUMNS + column;
+      uint32_t hash = hashSpriteArea(sprite, originX, originY, intersection(tileRect(column, row), visible));
+      tileChanged[tile] = (hash != hashes[tile]);
+      hashes[tile] = hash;
+      if (tileChanged[tile]) changed++;
+      total++;
+    }
+  }
+
+  if (count) {
+    systemStatus.performance.tilesPushed += changed;
+    systemStatus.performance.tilesSkipped += total - changed;
+  }
+  return changed;
+}
+
+// Überträgt pro Kachelzeile die zusammenhängenden Läufe geänderter Kacheln.
+// Synchron: pushImageDMA würde den Sprite beim Clippen umkopieren.
+static void pushChangedTileRuns(TFT_eSprite& sprite, int32_t x, int32_t y, const DirtyRect& visible) {
+  finishPanelDMA();
+
+  for (int row = firstTileRow(visible); row <= lastTileRow(visible); row++) {
+    DirtyRect run;
+    for (int column = firstTileColumn(visible); column <= lastTileColumn(visible); column++) {
+      if (tileChanged[row * TileCacheConfig::COLUMNS + column]) {
+        run = run.unionWith(intersection(tileRect(column, row), visible));
+        continue;
+      }
+      if (!run.isEmpty()) {
+        tft.accountArea(run);
+        tft.pushSpriteClipped(sprite, x, y, run);
+        run = DirtyRect();
+      }
+    }
+    if (!run.isEmpty()) {
+      tft.accountArea(run);
+      tft.pushSpriteClipped(sprite, x, y, run);
+    }
+  }
+}
+
+void pushSpritePartsToPanel(TFT_eSprite& sprite, int32_t x, int32_t y, const DirtyRect* parts, int count) {
+  DirtyRect visible = tft.visibleArea(x, y, sprite.width(), sprite.height());
+  if (visible.isEmpty()) return;
+
+  if (TileCacheConfig::ENABLED) {
+    int total = 0;
+    updateTileHashes(sprite, x + tft.getViewportX(), y + tft.getViewportY(), visible, total, false);
+  }
+
+  finishPanelDMA();
+  for (int i = 0; i < count; i++) {
+    DirtyRect part = intersection(parts[i], visible);
+    if (part.isEmpty()) continue;
+    tft.accountArea(part);
+    tft.pushSpriteClipped(sprite, x, y, part);
+  }
+}
+
+void pushSpriteToPanel(TFT_eSprite& sprite, int32_t x, int32_t y) {
+  DirtyRect visible = tft.visibleArea(x, y, sprite.width(), sprite.height());
+  if (visible.isEmpty()) return;
+
+  if (TileCacheConfig::ENABLED) {
+    // Sprite-Ursprung in absoluten Panel-Koordinaten (getViewportX/Y = Datum)
+    int total = 0;
+    int changed = updateTileHashes(sprite, x + tft.getViewportX(), y + tft.getViewportY(), visible, total);
+    if (changed == 0) return;
+    if (changed < total) {
+      pushChangedTileRuns(sprite, x, y, visible);
+      return;
+    }
+  }
+
+  claimFramePanel();
+  tft.accountArea(visible);
+
+  if (!panelDmaActive) {
+    sprite.pushSprite(x, y);
+    return;
+  }
+
+  // Sprite-Puffer liegt bereits in Panel-Byte-Reihenfolge vor
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+  tft.pushImageDMA(x, y, sprite.width(), sprite.height(), (uint16_t*)sprite.getPointer());
+  tft.setSwapBytes(swap);
+  renderTaskStats.dmaPushes++;
+}
+
+void finishPanelDMA() {
+  claimFramePanel();   // danach schreibt der Aufrufer aufs Panel
+  if (panelDmaActive) {
+    tft.dmaWait();
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              PANEL-WÄCHTER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct PanelWatch {
+  DirtyRect area;
+  int panel = PanelConfig::MAIN;
+  bool intact = false;
+};
+
+static PanelWatch panelWatches[PanelWatchConfig::SLOTS];
+
+void watchPanelArea(int slot, const DirtyRect& area) {
+  if (slot < 0 || slot >= PanelWatchConfig::SLOTS) return;
+  panelWatches[slot].area = area;
+  panelWatches[slot].panel = activePanel();
+  panelWatches[slot].intact = !area.isEmpty();
+}
+
+bool isPanelAreaIntact(int slot, const DirtyRect& area) {
+  if (slot < 0 || slot >= PanelWatchConfig::SLOTS) return false;
+  const PanelWatch& watch = panelWatches[slot];
+  return watch.intact && watch.panel == activePanel() &&
+         watch.area.contains(area) && area.contains(watch.area);
+}
+
+void notePanelWrite(const DirtyRect& area) {
+  for (PanelWatch& watch : panelWatches) {
+    if (watch.intact && watch.panel == activePanel() && watch.area.intersects(area)) watch.intact = false;
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              BAND-RENDERER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static TFT_eSprite bandSprite(&tft);
+static TFT_eSprite bandSpriteAlt(&tft);
+static bool altBandFailed = false;
+static TFT_eSprite* drawingBand = nullptr;   // gesetzt während drawBand läuft
+
+static bool createBandSprite(TFT_eSprite& sprite) {
+  sprite.setColorDepth(16);
+  sprite.setAttribute(PSRAM_ENABLE, false);  // DMA kann nur aus internem RAM lesen
+  return sprite.createSprite(Layout::DISPLAY_WIDTH, BandRenderConfig::ROWS) != nullptr;
+}
+
+// Legt den ersten Band-Sprite bei Bedarf an; false nach Fehlschlag
+static bool ensureBandSprite() {
+  if (bandSprite.created()) return true;
+
+  // Nach einem Fehlschlag nicht bei jedem Frame erneut versuchen
+  if (spriteRenderStats.bandAllocationFailed) return false;
+
+  if (!createBandSprite(bandSprite)) {
+    spriteRenderStats.bandAllocationFailed = true;
+    Serial.println("WARNUNG - Band-Sprite konnte nicht angelegt werden, zeichne Vollbilder direkt");
+    return false;
+  }
+  Serial.printf("Band-Sprite angelegt (%dx%d, %d Bytes)\n",
+                Layout::DISPLAY_WIDTH, BandRenderConfig::ROWS,
+                Layout::DISPLAY_WIDTH * BandRenderConfig::ROWS * 2);
+  return true;
+}
+
+// Zeichnet ein Band in den Sprite (Panel-Koordinaten, auf das Band geclippt)
+static void drawBandInto(TFT_eSprite& sprite, const DirtyRect& band, BandDrawFunction drawBand,
+                         const void* context) {
+  // Datum um -bandY verschieben, auf das Band clippen
+  sprite.setViewport(0, -band.y, Layout::DISPLAY_WIDTH, band.y + band.h);
+  {
+    CanvasScope scope(sprite);
+    drawingBand = &sprite;
+    drawBand(band, context);
+    drawingBand = nullptr;
+  }
+  sprite.resetViewport();
+}
+
+TFT_eSprite* currentBandSprite() {
+  return drawingBand;
+}
+
+// Ein Band-Durchlauf für ein Panel
+struct PanelScene {
+  int panel;
+  BandDrawFunction drawBand;
+  const void* context;
+  const CachedLayer* background;
+  CachedLayer* capture;
+};
+
+static PanelScene panelScenes[PanelConfig::COUNT];   // drawBand = nullptr: keine Szene
+static bool panelSceneDirty[PanelConfig::COUNT];
+
+void setPanelScene(int panel, BandDrawFunction drawBand, const void* context) {
+  if (panel == PanelConfig::MAIN || panel < 0 || panel >= PanelConfig::COUNT) return;
+  panelScenes[panel] = {panel, drawBand, context, nullptr, nullptr};
+}
+
+void markPanelSceneDirty(int panel) {
+  if (panel == PanelConfig::MAIN || panel < 0 || panel >= PanelConfig::COUNT) return;
+  panelSceneDirty[panel] = panelScenes[panel].drawBand != nullptr;
+}
+
+// Baut alle geänderten Szenen weiterer Panels und optional die des
+// Hauptpanels Band für Band auf, die Panels im Wechsel. Das Hauptpanel kommt
+// in jeder Bandzeile zuletzt und ist danach ausgewählt.
+static bool renderScenesInBands(const PanelScene* mainScene) {
+  PanelScene scenes[PanelConfig::COUNT];
+  int count = 0;
+  for (int panel = 0; panel < PanelConfig::COUNT; panel++) {
+    if (panel != PanelConfig::MAIN && panelSceneDirty[panel]) scenes[count++] = panelScenes[panel];
+  }
+  if (mainScene != nullptr) scenes[count++] = *mainScene;
+  if (count == 0) return true;
+
+  if (!ensureBandSprite()) return false;
+
+  if (panelDmaActive && !bandSpriteAlt.created() && !altBandFailed) {
+    altBandFailed = !createBandSprite(bandSpriteAlt);
+    if (altBandFailed) {
+      Serial.println("WARNUNG - Zweiter Band-Sprite fehlt, Bänder ohne Ping-Pong");
+    }
+  }
+  bool pingPong = panelDmaActive && !altBandFailed;
+  bool useAlt = false;
+  RasterScope raster;   // Panel nur für Push und laufende DMA halten
+
+  for (int bandY = 0; bandY < Layout::DISPLAY_HEIGHT; bandY += BandRenderConfig::ROWS) {
+    int rows = min(BandRenderConfig::ROWS, Layout::DISPLAY_HEIGHT - bandY);
+    DirtyRect band(0, bandY, Layout::DISPLAY_WIDTH, rows);
+
+    for (int i = 0; i < count; i++) {
+      const PanelScene& scene = scenes[i];
+
+      // Einziger Puffer darf erst nach Ende der Übertragung neu gefüllt werden;
+      // bei Ping-Pong ist der andere Puffer immer frei (siehe Sensor-Boxen)
+      if (!pingPong) finishPanelDMA();
+      raster.yieldPanel();
+      TFT_eSprite& sprite = useAlt ? bandSpriteAlt : bandSprite;
+
+      if (scene.background != nullptr) scene.background->copyTo(sprite, 0, bandY, band);
+      drawBandInto(sprite, band, scene.drawBand, scene.context);
+      if (scene.capture != nullptr) scene.capture->appendRows(sprite, bandY, rows);
+
+      // Erst jetzt umschalten: das Band wurde gezeichnet, während das
+      // vorherige (meist auf dem anderen Panel) noch per DMA lief.
+      // Zeilen unterhalb des Panels (letztes, kürzeres Band) clippt das Panel.
+      selectPanel(scene.panel);
+      pushSpriteToPanel(sprite, 0, bandY);
+      spriteRenderStats.bandPushes++;
+      useAlt = pingPong && !useAlt;
+    }
+  }
+
+  for (int panel = 0; panel < PanelConfig::COUNT; panel++) {
+    if (panel == PanelConfig::MAIN || !panelSceneDirty[panel]) continue;
+    panelSceneDirty[panel] = false;
+    panelStats.sceneFrames++;
+    if (mainScene != nullptr) panelStats.interleavedFrames++;
+  }
+  selectPanel(PanelConfig::MAIN);
+  return true;
+}
+
+bool renderFrameInBands(BandDrawFunction drawBand, const void* context,
+                        const CachedLayer* background, CachedLayer* capture) {
+  PanelScene scene = {PanelConfig::MAIN, drawBand, context, background, capture};
+  if (!renderScenesInBands(&scene)) return false;
+
+  spriteRenderStats.bandFrames++;
+  return true;
+}
+
+void flushPanelScenes() {
+  renderScenesInBands(nullptr);
+}
+
+bool captureFrameInBands(BandDrawFunction drawBand, const void* context, CachedLayer& layer, uint32_t key,
+                         const CachedLayer* background) {
+  if (!ensureBandSprite()) return false;
+
+  // Der einzige Puffer könnte noch per DMA übertragen werden
+  finishPanelDMA();
+  RasterScope raster;   // schreibt nur in den Layer, nicht aufs Panel
+
+  layer.beginCapture(key);
+  for (int bandY = 0; bandY < Layout::DISPLAY_HEIGHT; bandY += BandRenderConfig::ROWS) {
+    int rows = min(BandRenderConfig::ROWS, Layout::DISPLAY_HEIGHT - bandY);
+    DirtyRect band(0, bandY, Layout::DISPLAY_WIDTH, rows);
+
+    if (background != nullptr) background->copyTo(bandSprite, 0, bandY, band);
+    drawBandInto(bandSprite, band, drawBand, context);
+    layer.appendRows(bandSprite, bandY, rows);
+  }
+  return layer.finishCapture();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RENDER-TASK
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static QueueHandle_t renderQueue = nullptr;
+static SemaphoreHandle_t displayMutex = nullptr;
+static SemaphoreHandle_t panelMutex = nullptr;
+static TaskHandle_t renderTaskHandle = nullptr;
+
+DisplayLock::DisplayLock() : locked(false) {
+  if (displayMutex != nullptr) {
+    locked = (xSemaphoreTakeRecursive(displayMutex, portMAX_DELAY) == pdTRUE);
+  }
+}
+
+DisplayLock::~DisplayLock() {
+  if (locked) {
+    xSemaphoreGiveRecursive(displayMutex);
+  }
+}
+
+PanelLock::PanelLock() : locked(false) {
+  if (panelMutex != nullptr) {
+    locked = (xSemaphoreTakeRecursive(panelMutex, portMAX_DELAY) == pdTRUE);
+  }
+}
+
+PanelLock::~PanelLock() {
+  if (locked) {
+    xSemaphoreGiveRecursive(panelMutex);
+  }
+}
+
+// Panel-Zugriff des Frames (nur der Task, der updateDisplay() ausführt)
+static bool panelFrameActive = false;   // zwischen beginPanelFrame() und endPanelFrame()
+static bool panelFrameHeld = false;     // PanelLock und startWrite() gehalten
+
+static void claimFramePanel() {
+  if (!panelFrameActive || panelFrameHeld) return;
+  if (panelMutex != nullptr) xSemaphoreTakeRecursive(panelMutex, portMAX_DELAY);
+  tft.startWrite();   // Panel für DMA-Übertragungen reservieren
+  panelFrameHeld = true;
+}
+
+// Gibt das Panel frei; mit wait = false nur, wenn keine Übertragung läuft
+static bool releaseFramePanel(bool wait) {
+  if (!panelFrameHeld) return false;
+  if (panelDmaActive) {
+    if (!wait && tft.dmaBusy()) return false;
+    tft.dmaWait();
+  }
+  tft.endWrite();
+  if (panelMutex != nullptr) xSemaphoreGiveRecursive(panelMutex);
+  panelFrameHeld = false;
+  return true;
+}
+
+void beginPanelFrame() {
+  panelFrameActive = true;
+  claimFramePanel();
+}
+
+void endPanelFrame() {
+  releaseFramePanel(true);
+  panelFrameActive = false;
+}
+
+RasterScope::RasterScope() {
+  yieldPanel();
+}
+
+RasterScope::~RasterScope() {
+  claimFramePanel();
+}
+
+void RasterScope::yieldPanel() {
+  if (releaseFramePanel(false)) renderTaskStats.panelYields++;
+}
+
+static void renderTaskLoop(void* parameter) {
+  (void)parameter;
+  RenderRequest request;
+
+  for (;;) {
+    if (xQueueReceive(renderQueue, &request, portMAX_DELAY) != pdTRUE) continue;
+
+    // Weitere wartende Anfragen zusammenfassen - der Frame zeichnet ohnehin
+    // alle bis dahin gesetzten Change-Flags
+    RenderRequest newer;
+    while (xQueueReceive(renderQueue, &newer, 0) == pdTRUE) {
+      renderTaskStats.coalescedRequests++;
+      if ((long)(newer.deadline - request.deadline) < 0) request.deadline = newer.deadline;
+    }
+
+    unsigned long latency = millis() - request.requestedAt;
+    unsigned long start = micros();
+    updateDisplay();   // sperrt selbst: Zustand kopieren, dann zeichnen
+    unsigned long duration = micros() - start;
+
+    renderTaskStats.frames++;
+    renderTaskStats.lastFrameMicros = duration;
+    renderTaskStats.maxFrameMicros = max(renderTaskStats.maxFrameMicros, duration);
+    renderTaskStats.maxQueueLatencyMs = max(renderTaskStats.maxQueueLatencyMs, latency);
+
+    long lateness = (long)(millis() - request.deadline);
+    if (lateness > 0) {
+      renderTaskStats.missedDeadlines++;
+      renderTaskStats.maxLatenessMs = max(renderTaskStats.maxLatenessMs, (unsigned long)lateness);
+    }
+  }
+}
+
+bool startRenderTask() {
+  if (renderTaskHandle != nullptr) return true;
+
+  renderQueue = xQueueCreate(RenderTaskConfig::QUEUE_LENGTH, sizeof(RenderRequest));
+  displayMutex = xSemaphoreCreateRecursiveMutex();
+  panelMutex = xSemaphoreCreateRecursiveMutex();
+  if (renderQueue == nullptr || displayMutex == nullptr || panelMutex == nullptr) {
+    Serial.println("WARNUNG - Render-Task: Queue/Mutex nicht verfügbar, zeichne synchron");
+    return false;
+  }
+
+  {
+    PanelLock panel;
+    panelDmaActive = tft.initDMA();
+    if (!panelDmaActive) {
+      Serial.println("WARNUNG - SPI-DMA nicht verfügbar, Sprites werden synchron übertragen");
+    }
+  }
+
+  BaseType_t created = xTaskCreatePinnedToCore(renderTaskLoop, "render",
+                                               RenderTaskConfig::STACK_SIZE, nullptr,
+                                               RenderTaskConfig::PRIORITY, &renderTaskHandle,
+                                               RenderTaskConfig::CORE);
+  if (created != pdPASS) {
+    renderTaskHandle = nullptr;
+    if (panelDmaActive) {
+      tft.deInitDMA();
+      panelDmaActive = false;
+    }
+    Serial.println("WARNUNG - Render-Task konnte nicht gestartet werden, zeichne synchron");
+    return false;
+  }
+
+  Serial.printf("Render-Task gestartet (Core %d, DMA: %s)\n",
+                RenderTaskConfig::CORE, panelDmaActive ? "ja" : "nein");
+  return true;
+}
+
+bool isRenderTaskRunning() {
+  return renderTaskHandle != nullptr;
+}
+
+bool requestRender(unsigned long deadline) {
+  if (renderTaskHandle == nullptr) return false;
+
+  RenderRequest request = { millis(), deadline };
+  if (xQueueSend(renderQueue, &request, 0) != pdTRUE) {
+    // Queue voll: ein Frame steht bereits an und zeichnet auch diese Änderungen
+    renderTaskStats.droppedRequests++;
+  }
+  return true;
+}
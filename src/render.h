@@ -0,0 +1,358 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+#include "profiler.h"
+#include "cached_layer.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              EXTERNE ABHÄNGIGKEITEN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Externe Objekte (definiert in main.cpp)
+// tft (ProfiledTFT) wird in profiler.h deklariert
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              ZEICHENZIEL (PANEL ODER SPRITE)
+// ═══════════════════════════════════════════════════════════════════════════════
+// Alle Widget-Funktionen zeichnen über canvas() statt direkt auf tft. Standard-
+// ziel ist das Panel; ein CanvasScope leitet die Zeichenbefehle für die Dauer
+// seines Blocks in einen Sprite um (TFT_eSprite erbt von TFT_eSPI).
+// Ziele ohne Pixel (Display-List-Recorder) werden mit pixels = false
+// eingesetzt; Caches, die statt der Original-Befehle andere Primitive
+// absetzen, greifen nur bei Pixel-Zielen (canvasHasPixels()).
+
+TFT_eSPI& canvas();
+bool canvasHasPixels();
+
+class CanvasScope {
+public:
+  explicit CanvasScope(TFT_eSPI& target, bool pixels = true);
+  ~CanvasScope();
+
+  CanvasScope(const CanvasScope&) = delete;
+  CanvasScope& operator=(const CanvasScope&) = delete;
+
+private:
+  TFT_eSPI* previous;
+  bool previousPixels;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              SPRITE-PUFFER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Wiederverwendbarer 16-Bit-Sprite in Sensor-Box-Größe (100x40 = 8 KB).
+// Wird beim ersten Zugriff angelegt; nullptr wenn die Allokation scheitert
+// oder die angefragte Größe nicht passt (Aufrufer zeichnen dann direkt).
+TFT_eSprite* acquireSensorBoxSprite(int width, int height);
+
+// Überträgt einen Sprite aufs Panel: bei aktivem DMA (Render-Task) per
+// pushImageDMA im Hintergrund, sonst synchron per pushSprite. Über den
+// Kachel-Cache gehen nur Kacheln mit geändertem Inhalt über SPI.
+void pushSpriteToPanel(TFT_eSprite& sprite, int32_t x, int32_t y);
+
+// Wartet auf eine laufende DMA-Übertragung. Muss vor jedem direkten
+// Zeichenbefehl auf das Panel aufgerufen werden.
+void finishPanelDMA();
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              MEHRERE PANELS
+// ═══════════════════════════════════════════════════════════════════════════════
+// Weitere Panels gleicher Größe hängen am selben SPI-Bus (MOSI, SCLK, DC, RST)
+// und haben je einen eigenen CS-Pin, den render.cpp schaltet (TFT_eSPI mit
+// TFT_CS=-1). tft zeichnet immer auf das ausgewählte Panel; Kachel-Cache und
+// Panel-Wächter führen je Panel eigene Einträge. Panel 0 trägt die Screens,
+// weitere Panels zeigen je eine Szene (siehe Band-Renderer).
+// Anzahl und CS-Pins als build_flags (PANEL_COUNT, PANEL_CS_*); ohne Angabe
+// ein Panel am CS aus dem TFT_eSPI-Setup.
+//
+// Alle Panels teilen einen SPI-Bus: Übertragungen laufen streng nacheinander,
+// selectPanel() wartet vor jedem CS-Wechsel per finishPanelDMA(). Parallel
+// laufen nur das Zeichnen des nächsten Bands und die DMA des vorherigen.
+
+#ifndef PANEL_COUNT
+#define PANEL_COUNT 1   // mehrere Panels: im TFT_eSPI-Setup zusätzlich TFT_CS=-1
+#endif
+#ifndef PANEL_CS_MAIN
+#if defined(TFT_CS) && TFT_CS >= 0
+#define PANEL_CS_MAIN TFT_CS
+#else
+#define PANEL_CS_MAIN 15
+#endif
+#endif
+#ifndef PANEL_CS_ENERGY_FLOW
+#define PANEL_CS_ENERGY_FLOW 22
+#endif
+
+namespace PanelConfig {
+  constexpr int COUNT = PANEL_COUNT;
+  constexpr int MAIN = 0;
+  constexpr int ENERGY_FLOW = 1;            // Energiefluss-Szene
+  constexpr int CS_PINS[] = {PANEL_CS_MAIN, PANEL_CS_ENERGY_FLOW};
+  static_assert(COUNT >= 1 && COUNT <= (int)(sizeof(CS_PINS) / sizeof(CS_PINS[0])),
+                "Für jedes Panel wird ein CS-Pin gebraucht");
+}
+
+// Vor tft.init(): alle CS-Pins aktiv, Init-Sequenz und erstes Löschen gehen
+// an alle Panels gleichzeitig. Danach selectPanel(PanelConfig::MAIN).
+void beginPanelBroadcast();
+
+// Schaltet CS auf 'panel' um; wartet vorher auf eine laufende DMA-Übertragung
+void selectPanel(int panel);
+int activePanel();
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              KACHEL-CACHE
+// ═══════════════════════════════════════════════════════════════════════════════
+// Das Panel ist in feste Kacheln geteilt. Pro Kachel wird ein Hash über den
+// zuletzt per Sprite übertragenen Inhalt (samt dessen Lage in der Kachel)
+// gehalten; pushSpriteToPanel() überträgt Kacheln mit gleichem Hash nicht
+// erneut. Direkte Zeichenbefehle aufs Panel machen die getroffenen Kacheln
+// ungültig (ProfiledTFT). Zählung in systemStatus.performance.
+
+namespace TileCacheConfig {
+  constexpr bool ENABLED = true;
+  constexpr int TILE_WIDTH = 32;
+  constexpr int TILE_HEIGHT = 12;    // teilt die Band-Höhe: Bänder decken ganze Kacheln
+  constexpr int COLUMNS = Layout::DISPLAY_WIDTH / TILE_WIDTH;
+  constexpr int ROWS = Layout::DISPLAY_HEIGHT / TILE_HEIGHT;
+  static_assert(COLUMNS * TILE_WIDTH == Layout::DISPLAY_WIDTH &&
+                ROWS * TILE_HEIGHT == Layout::DISPLAY_HEIGHT, "Kacheln müssen das Panel teilen");
+}
+
+// Kacheln im Bereich (absolute Panel-Koordinaten) als unbekannt markieren
+void invalidatePanelTiles(const DirtyRect& area);
+
+// Für Sprites, deren Inhalt bis auf 'parts' schon auf dem Panel steht:
+// überträgt nur diese Teile (absolut, innerhalb des Viewports) und übernimmt
+// den ganzen Sprite in den Kachel-Cache.
+void pushSpritePartsToPanel(TFT_eSprite& sprite, int32_t x, int32_t y, const DirtyRect* parts, int count);
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              PANEL-WÄCHTER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Wer den Panel-Inhalt eines Bereichs nach seinem Push exakt kennt (Sensor-Box
+// mit Segment-Balken), meldet den Bereich hier an. Jeder spätere
+// Schreibzugriff, der ihn berührt - direkte Zeichenbefehle, Sprite- und
+// Band-Pushes, auch die eigenen -, macht ihn ungültig. Kacheln eignen sich
+// dafür nicht: Nachbar-Boxen teilen sich Randkacheln.
+
+namespace PanelWatchConfig {
+  constexpr int SLOTS = System::SENSOR_COUNT;   // eine je Sensor-Box
+}
+
+void watchPanelArea(int slot, const DirtyRect& area);
+bool isPanelAreaIntact(int slot, const DirtyRect& area);
+
+// Von ProfiledTFT bei jedem Schreibzugriff aufgerufen (absolute Koordinaten)
+void notePanelWrite(const DirtyRect& area);
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              BAND-RENDERER
+// ═══════════════════════════════════════════════════════════════════════════════
+// Ein voller Framebuffer (320x240x2 = 150 KB) passt nicht in den RAM ohne
+// PSRAM. Stattdessen wird ein Vollbild in Streifen von 320xROWS Pixeln
+// aufgebaut: Zeichenbefehle laufen per CanvasScope in einen Band-Sprite
+// (Datum auf die Band-Oberkante verschoben, auf das Band geclippt), danach
+// wird das Band übertragen. Bei aktivem DMA wechseln sich zwei Puffer ab.
+// Das Panel zeigt so nie einen gelöschten Zwischenstand (kein Flackern).
+
+namespace BandRenderConfig {
+  constexpr int ROWS = 24;   // 320 x 24 x 2 Byte = 15 KB pro Puffer, 10 Bänder
+  static_assert(ROWS > 0 && ROWS <= Layout::DISPLAY_HEIGHT, "Band-Höhe ungültig");
+  static_assert(ROWS % TileCacheConfig::TILE_HEIGHT == 0, "Bänder sollen ganze Kachelzeilen decken");
+}
+
+// Zeichnet den Inhalt eines Bands (Panel-Koordinaten) auf canvas(). Der
+// Hintergrund des Bands ist nicht gelöscht; context wird durchgereicht.
+typedef void (*BandDrawFunction)(const DirtyRect& band, const void* context);
+
+// Innerhalb einer BandDrawFunction: der Band-Sprite, in den gerade gezeichnet
+// wird (seine Zeile 0 liegt bei band.y), sonst nullptr. Für Layer-Caches,
+// die Pixel direkt aus dem Puffer lesen oder hineinschreiben.
+TFT_eSprite* currentBandSprite();
+
+// Baut das ganze Panel bandweise auf. Mit 'background' wird jedes Band vor
+// drawBand aus diesem Layer befüllt; mit 'capture' wird jedes fertige Band
+// zusätzlich dort angehängt (beginCapture/finishCapture durch den Aufrufer).
+// false wenn kein Band-Sprite angelegt werden kann - der Aufrufer zeichnet
+// dann direkt.
+bool renderFrameInBands(BandDrawFunction drawBand, const void* context,
+                        const CachedLayer* background = nullptr, CachedLayer* capture = nullptr);
+
+// Zeichnet das ganze Panel bandweise, ohne zu übertragen, und nimmt das
+// Ergebnis unter 'key' in den Layer auf ('background' wie oben). false wenn
+// kein Band-Sprite verfügbar ist oder der Layer überläuft.
+bool captureFrameInBands(BandDrawFunction drawBand, const void* context, CachedLayer& layer, uint32_t key,
+                         const CachedLayer* background = nullptr);
+
+// Szene eines weiteren Panels (nicht PanelConfig::MAIN). Ist sie als geändert
+// markiert, zeichnet der nächste Band-Durchlauf des Hauptpanels ihre Bänder
+// abwechselnd mit den eigenen: während ein Band per DMA läuft, wird schon
+// das nächste - für das andere Panel - gezeichnet. Ohne Vollbild auf dem
+// Hauptpanel überträgt flushPanelScenes() sie am Ende des Frames. Der
+// Kachel-Cache des Panels überspringt unveränderte Kacheln.
+void setPanelScene(int panel, BandDrawFunction drawBand, const void* context);
+void markPanelSceneDirty(int panel);
+
+// Überträgt noch ausstehende Szenen; danach ist das Hauptpanel ausgewählt
+void flushPanelScenes();
+
+// Statistik
+struct SpriteRenderStats {
+  unsigned long spritePushes = 0;      // Boxen per Sprite übertragen
+  unsigned long directFallbacks = 0;   // Boxen ohne Sprite gezeichnet
+  bool allocationFailed = false;
+  unsigned long bandFrames = 0;        // Vollbilder per Band-Renderer
+  unsigned long bandPushes = 0;        // übertragene Bänder
+  bool bandAllocationFailed = false;
+};
+
+extern SpriteRenderStats spriteRenderStats;
+
+struct PanelStats {
+  unsigned long panelSwitches = 0;     // CS-Umschaltungen
+  unsigned long sceneFrames = 0;       // Szenen weiterer Panels übertragen
+  unsigned long interleavedFrames = 0; // davon im Band-Durchlauf des Hauptpanels
+};
+
+extern PanelStats panelStats;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              RENDER-TASK
+// ═══════════════════════════════════════════════════════════════════════════════
+// Ein eigener Task auf Core 0 besitzt das Panel: loop() (Core 1) stellt nur noch
+// Render-Anfragen in die Queue, der Task zeichnet den Frame und überträgt die
+// Sensor-Boxen per SPI-DMA. Gezeichnet wird aus einer Kopie des Zustands
+// (frameState, display.h) - Netzwerk und Touch warten höchstens auf das
+// Kopieren, nicht auf SPI.
+
+namespace RenderTaskConfig {
+  constexpr int CORE = 0;                // loop() läuft auf Core 1
+  constexpr uint32_t STACK_SIZE = 8192;
+  constexpr UBaseType_t PRIORITY = 1;    // unterhalb von WiFi/LwIP
+  constexpr int QUEUE_LENGTH = 4;
+}
+
+struct RenderRequest {
+  unsigned long requestedAt;   // millis() beim Einstellen
+  unsigned long deadline;      // millis(), bis wann der Frame stehen soll
+};
+
+// Startet den Task (einmalig am Ende von setup()). false = synchron weiter.
+bool startRenderTask();
+bool isRenderTaskRunning();
+
+// Stellt eine Render-Anfrage ein (Deadline aus dem RenderManager). false wenn
+// kein Task läuft; der Aufrufer zeichnet dann selbst per updateDisplay().
+bool requestRender(unsigned long deadline);
+
+// Sperre für den Display-Zustand (rekursiv): RenderManager-Flags, Sensor-
+// und Energiedaten, Modus. Wer sie ändert (MQTT, Touch, OTA), nimmt sie; der
+// Renderer hält sie nur zum Kopieren in frameState und zum Zurückgeben der
+// Reste, nie während gezeichnet oder übertragen wird.
+// Vor dem Start des Tasks sind beide Sperren wirkungslos.
+class DisplayLock {
+public:
+  DisplayLock();
+  ~DisplayLock();
+
+  DisplayLock(const DisplayLock&) = delete;
+  DisplayLock& operator=(const DisplayLock&) = delete;
+
+private:
+  bool locked;
+};
+
+// Sperre für Panel und SPI-Bus (rekursiv): updateDisplay() schreibt darunter
+// (siehe beginPanelFrame()), ebenso alles, was direkt auf das Panel zeichnet
+// (OTA-Bildschirm, Kalibrierung, WiFi-Meldungen, Fehlerbildschirm) oder den
+// Bus mitbenutzt (XPT2046-Touch). Reihenfolge: PanelLock darf unter DisplayLock genommen
+// werden, DisplayLock nie unter PanelLock.
+class PanelLock {
+public:
+  PanelLock();
+  ~PanelLock();
+
+  PanelLock(const PanelLock&) = delete;
+  PanelLock& operator=(const PanelLock&) = delete;
+
+private:
+  bool locked;
+};
+
+// Panel-Zugriff des Frames: updateDisplay() hält PanelLock und die SPI-
+// Transaktion (startWrite) nur, solange es aufs Panel schreibt oder eine
+// DMA-Übertragung läuft. Reine Sprite-Arbeit (Sensor-Boxen, Bänder, Layer-
+// Aufnahmen) läuft in einem RasterScope ohne beides; pushSpriteToPanel(),
+// selectPanel() und finishPanelDMA() holen das Panel bei Bedarf zurück, am
+// Ende des Blocks gehört es wieder dem Frame. So wartet der XPT2046-Touch
+// höchstens eine Übertragung statt eines ganzen Frames.
+void beginPanelFrame();
+void endPanelFrame();   // wartet auf DMA, endWrite(), gibt PanelLock frei
+
+class RasterScope {
+public:
+  RasterScope();
+  ~RasterScope();
+
+  // Erneut freigeben (z.B. vor jedem Band); bleibt bei laufender DMA gehalten
+  void yieldPanel();
+
+  RasterScope(const RasterScope&) = delete;
+  RasterScope& operator=(const RasterScope&) = delete;
+};
+
+// Statistik
+struct RenderTaskStats {
+  unsigned long frames = 0;             // gezeichnete Frames
+  unsigned long coalescedRequests = 0;  // zusammengefasste Anfragen
+  unsigned long droppedRequests = 0;    // Queue voll (Frame stand schon an)
+  unsigned long dmaPushes = 0;          // Sprites per DMA übertragen
+  unsigned long panelYields = 0;        // Panel während des Frames freigegeben
+  unsigned long lastFrameMicros = 0;
+  unsigned long maxFrameMicros = 0;
+  unsigned long maxQueueLatencyMs = 0;  // Anfrage bis Frame-Beginn
+  unsigned long missedDeadlines = 0;    // Frame erst nach der Deadline fertig
+  unsigned long maxLatenessMs = 0;
+};
+
+extern RenderTaskStats renderTaskStats;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              FRAME-BUDGET
+// ═══════════════════════════════════════════════════════════════════════════════
+// Selektive Home-Frames zeichnen ihre Widgets nach Vorrang: Touch-Feedback,
+// dann Werte (Sensor-Boxen samt Trend-Pfeil und Balken - eine Box ist ein
+// Sprite - und Uhr), dann Status-Dekoration (System-Info, Netzwerk). Ist das
+// Budget aufgebraucht, wandern die restlichen Widgets in den nächsten Frame.
+// Touch-Feedback wird nie verschoben. Vollbilder und Anti-Burnin-Verschiebungen
+// (alle Widgets müssen gemeinsam wandern) laufen ohne Budget.
+
+namespace FrameBudgetConfig {
+  constexpr bool ENABLED = true;
+  constexpr unsigned long BUDGET_US = 20000;             // je Frame
+  constexpr unsigned long DEFERRED_DEADLINE_MS = 20;     // Folge-Frame für Verschobenes
+}
+
+enum RenderPriority {
+  PRIORITY_TOUCH = 0,
+  PRIORITY_VALUES,
+  PRIORITY_DECORATION,
+  PRIORITY_COUNT
+};
+
+struct FrameBudgetStats {
+  unsigned long budgetedFrames = 0;    // selektive Frames mit Budget
+  unsigned long exceededFrames = 0;    // Budget überschritten
+  unsigned long deferredFrames = 0;    // davon mit verschobenen Widgets
+  unsigned long deferredWidgets = 0;
+  unsigned long maxFrameMicros = 0;
+};
+
+extern FrameBudgetStats frameBudgetStats;
+
+#endif // RENDER_H
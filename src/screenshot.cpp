@@ -0,0 +1,235 @@
+#include "screenshot.h"
+#include "display.h"
+#include "frame_scheduler.h"
+#include <atomic>
+
+ScreenshotStats screenshotStats;
+
+static bool fullRequested = false;
+static bool streaming = false;
+static bool baseValid = false;               // Empfänger kennt ein Vollbild (Deltas möglich)
+static unsigned long lastKeyframe = 0;
+static unsigned long lastDelta = 0;
+static uint16_t sequence = 0;
+
+// Eigener Aufnahme-Layer, bei der ersten Anfrage angelegt
+static uint16_t* scratchRuns = nullptr;
+static CachedLayer* scratchLayer = nullptr;
+
+// Zeilen-Hashes des zuletzt gesendeten Bildes (Farben, nicht Palettenindizes)
+static uint32_t sentRowHashes[Layout::DISPLAY_HEIGHT];
+
+// Fertige Nachricht: zwischen Aufnahme (Render-Task) und Senden (loop)
+struct ScreenshotRange {
+  uint16_t firstRow;
+  uint16_t rows;
+};
+
+// ready veröffentlicht die Felder darunter: Schreiber setzt es mit release
+// nach allen Feldern, Leser prüft es mit acquire vor dem ersten Zugriff
+static std::atomic<bool> ready(false);
+static const CachedLayer* source = nullptr;
+static ScreenshotType messageType = SCREENSHOT_FULL;
+static uint16_t messageSequence = 0;
+static ScreenshotRange ranges[ScreenshotConfig::MAX_RANGES];
+static int rangeCount = 0;
+static int publishAttempts = 0;
+
+void requestScreenshot() {
+  if (!ScreenshotConfig::ENABLED) return;
+  fullRequested = true;
+  renderManager.scheduleFrame(Timing::FRAME_DEADLINE_TOUCH);
+}
+
+void setScreenshotStream(bool enabled) {
+  if (!ScreenshotConfig::ENABLED) return;
+  streaming = enabled;
+  if (enabled) requestScreenshot();
+  Serial.printf("Screenshot-Stream %s\n", enabled ? "gestartet" : "beendet");
+}
+
+bool isScreenshotStreaming() {
+  return streaming;
+}
+
+bool isLayerLentToScreenshot(const CachedLayer* layer) {
+  return ready.load(std::memory_order_acquire) && source == layer;
+}
+
+static CachedLayer* ensureScratchLayer() {
+  if (scratchLayer != nullptr) return scratchLayer;
+  scratchRuns = (uint16_t*)malloc(ScreenshotConfig::RUNS * sizeof(uint16_t));
+  if (scratchRuns == nullptr) return nullptr;
+  scratchLayer = new CachedLayer(scratchRuns, ScreenshotConfig::RUNS);
+  return scratchLayer;
+}
+
+static uint32_t rowHash(const CachedLayer& layer, int row) {
+  uint32_t hash = 2166136261u;
+  const uint16_t* runs = layer.rowRuns(row);
+  for (int r = 0; r < layer.runCountOfRows(row, 1); r++) {
+    uint32_t run = ((uint32_t)layer.paletteEntry(runs[r] >> CachedLayerConfig::LENGTH_BITS) << 16) |
+                   (runs[r] & ((1 << CachedLayerConfig::LENGTH_BITS) - 1));
+    hash = (hash ^ run) * 16777619u;
+  }
+  return hash;
+}
+
+// Geänderte Zeilen zu Bereichen zusammenfassen; false wenn es zu viele sind
+static bool collectChangedRows(const uint32_t* hashes) {
+  rangeCount = 0;
+  for (int row = 0; row < Layout::DISPLAY_HEIGHT; row++) {
+    if (hashes[row] == sentRowHashes[row]) continue;
+
+    if (rangeCount > 0 && ranges[rangeCount - 1].firstRow + ranges[rangeCount - 1].rows == row) {
+      ranges[rangeCount - 1].rows++;
+      continue;
+    }
+    if (rangeCount == ScreenshotConfig::MAX_RANGES) return false;
+    ranges[rangeCount++] = {(uint16_t)row, 1};
+  }
+  return true;
+}
+
+void updateScreenshotCapture() {
+  if (!ScreenshotConfig::ENABLED || ready.load(std::memory_order_acquire)) return;
+
+  unsigned long now = millis();
+  bool keyframe = fullRequested || (streaming && (!baseValid || now - lastKeyframe >= ScreenshotConfig::KEYFRAME_INTERVAL_MS));
+  if (!keyframe && !streaming) return;
+
+  // Delta zu früh: Frame zum Ende des Intervalls nachholen (geht mit den
+  // Resten des Frames an den RenderManager, updateDisplay() weckt loop())
+  if (!keyframe && now - lastDelta < ScreenshotConfig::DELTA_INTERVAL_MS) {
+    frameState.renderManager.scheduleFrame(ScreenshotConfig::DELTA_INTERVAL_MS - (now - lastDelta));
+    return;
+  }
+
+  CachedLayer* scratch = ensureScratchLayer();
+  if (scratch == nullptr) {
+    Serial.println("WARNUNG - Kein Speicher für den Screenshot-Layer");
+    screenshotStats.failures++;
+    fullRequested = false;
+    streaming = false;
+    return;
+  }
+
+  unsigned long start = micros();
+  const CachedLayer* layer = captureMainScreen(*scratch);
+  screenshotStats.maxCaptureMicros = max(screenshotStats.maxCaptureMicros, micros() - start);
+  if (layer == nullptr) {
+    Serial.println("WARNUNG - Screenshot-Aufnahme fehlgeschlagen (Band-Sprite oder Layer-Überlauf)");
+    screenshotStats.failures++;
+    fullRequested = false;
+    return;
+  }
+  if (layer != scratch) screenshotStats.frameLayerReuses++;
+
+  uint32_t hashes[Layout::DISPLAY_HEIGHT];
+  for (int row = 0; row < Layout::DISPLAY_HEIGHT; row++) hashes[row] = rowHash(*layer, row);
+
+  if (!keyframe) {
+    lastDelta = now;
+    if (!collectChangedRows(hashes)) {
+      keyframe = true;
+    } else if (rangeCount == 0) {
+      return;   // Panel unverändert: nichts senden
+    }
+  }
+  if (keyframe) {
+    ranges[0] = {0, (uint16_t)Layout::DISPLAY_HEIGHT};
+    rangeCount = 1;
+    lastKeyframe = now;
+    lastDelta = now;
+    fullRequested = false;
+  }
+
+  memcpy(sentRowHashes, hashes, sizeof(sentRowHashes));
+  baseValid = true;
+  source = layer;
+  messageType = keyframe ? SCREENSHOT_FULL : SCREENSHOT_DELTA;
+  messageSequence = sequence++;
+  ready.store(true, std::memory_order_release);
+  wakeFrameScheduler();   // loop() sendet
+}
+
+bool screenshotReady() {
+  return ready.load(std::memory_order_acquire);
+}
+
+size_t screenshotMessageSize() {
+  if (!ready.load(std::memory_order_acquire)) return 0;
+  size_t size = ScreenshotConfig::HEADER_BYTES + source->paletteSize() * sizeof(uint16_t);
+  for (int i = 0; i < rangeCount; i++) {
+    size += ScreenshotConfig::RANGE_HEADER_BYTES +
+            source->runCountOfRows(ranges[i].firstRow, ranges[i].rows) * sizeof(uint16_t);
+  }
+  return size;
+}
+
+static uint8_t* putU16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+  return out + 2;
+}
+
+bool writeScreenshotMessage(ScreenshotWriteFunction write) {
+  if (!ready.load(std::memory_order_acquire)) return false;
+
+  uint8_t header[ScreenshotConfig::HEADER_BYTES];
+  memcpy(header, "SHS1", 4);
+  header[4] = messageType;
+  header[5] = (uint8_t)source->paletteSize();
+  uint8_t* out = putU16(header + 6, Layout::DISPLAY_WIDTH);
+  out = putU16(out, Layout::DISPLAY_HEIGHT);
+  out = putU16(out, messageSequence);
+  out = putU16(out, (uint16_t)rangeCount);
+  putU16(out, 0);
+  if (!write(header, sizeof(header))) return false;
+
+  // Palette aus Sprite-Byte-Reihenfolge in RGB565
+  uint8_t palette[CachedLayerConfig::PALETTE_SIZE * 2];
+  for (int i = 0; i < source->paletteSize(); i++) {
+    uint16_t color = source->paletteEntry(i);
+    putU16(palette + 2 * i, (uint16_t)((color >> 8) | (color << 8)));
+  }
+  if (!write(palette, source->paletteSize() * 2)) return false;
+
+  // Läufe direkt aus dem Layer (ESP32 und Host sind Little Endian)
+  for (int i = 0; i < rangeCount; i++) {
+    int runs = source->runCountOfRows(ranges[i].firstRow, ranges[i].rows);
+    uint8_t rangeHeader[ScreenshotConfig::RANGE_HEADER_BYTES];
+    out = putU16(rangeHeader, ranges[i].firstRow);
+    out = putU16(out, ranges[i].rows);
+    putU16(out, (uint16_t)runs);
+    if (!write(rangeHeader, sizeof(rangeHeader))) return false;
+    if (!write((const uint8_t*)source->rowRuns(ranges[i].firstRow), runs * sizeof(uint16_t))) return false;
+  }
+  return true;
+}
+
+void releaseScreenshot(bool published) {
+  if (!ready.load(std::memory_order_acquire)) return;
+  if (published) {
+    if (messageType == SCREENSHOT_FULL) screenshotStats.fullFrames++;
+    else screenshotStats.deltas++;
+    screenshotStats.bytes += screenshotMessageSize();
+  } else {
+    // Empfänger hat die Basis für weitere Deltas nicht: nächstes Mal Vollbild
+    screenshotStats.failures++;
+    baseValid = false;
+  }
+  source = nullptr;
+  publishAttempts = 0;
+  ready.store(false, std::memory_order_release);
+}
+
+bool deferScreenshot() {
+  if (!ready.load(std::memory_order_acquire)) return false;
+  if (++publishAttempts >= ScreenshotConfig::PUBLISH_ATTEMPTS) {
+    releaseScreenshot(false);
+    return false;
+  }
+  screenshotStats.retries++;
+  return true;
+}
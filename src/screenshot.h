@@ -0,0 +1,86 @@
+#ifndef SCREENSHOT_H
+#define SCREENSHOT_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "cached_layer.h"
+
+extern RenderManager renderManager;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+//                              SCREENSHOTS ÜBER MQTT
+// ═══════════════════════════════════════════════════════════════════════════════
+// Auf Anfrage (NetworkConfig::SCREENSHOT_REQUEST) wird der Inhalt des
+// Hauptpanels als Lauflängen-Bild mit Palette auf NetworkConfig::SCREENSHOT
+// veröffentlicht - im Format der gecachten Layer, ohne Framebuffer:
+//   "full"/leer  ein Vollbild
+//   "stream"     Vollbild, danach Deltas (geänderte Zeilenbereiche)
+//   "stop"       Stream beenden
+//
+// Aufnahme im Render-Kontext nach einem Frame (updateDisplay()): steht das
+// gezeigte Home-Bild unverändert im Frame-Layer, wird dieser direkt
+// gesendet; sonst ein Band-Durchlauf ohne Übertragung in einen eigenen Layer
+// (Home aus dem Chrome-Layer). Deltas vergleichen Zeilen-Hashes mit dem
+// zuletzt gesendeten Bild und kommen höchstens alle DELTA_INTERVAL_MS.
+// Veröffentlicht wird aus loop(), direkt aus den Läufen des Layers; solange
+// der Frame-Layer verliehen ist, nimmt der Renderer ihn nicht neu auf.
+//
+// Nachricht (Little Endian), Decoder: tools/decode_screenshot.py
+//   Kopf     "SHS1", Typ 'F'/'D', Palettengröße, Breite, Höhe, Sequenz,
+//            Anzahl Zeilenbereiche, reserviert (je u8/u16, 16 Bytes)
+//   Palette  RGB565 je u16
+//   Bereich  erste Zeile, Zeilen, Läufe (u16), dann die Läufe
+//            (Farbindex << 11 | Länge), Zeile für Zeile
+// Deltas beziehen sich auf die Nachricht mit Sequenz - 1.
+
+namespace ScreenshotConfig {
+  constexpr bool ENABLED = true;
+  constexpr int RUNS = CachedLayerConfig::FRAME_RUNS;     // eigener Layer, erst bei Bedarf angelegt
+  constexpr unsigned long DELTA_INTERVAL_MS = 500;        // höchstens 2 Deltas/s
+  constexpr unsigned long KEYFRAME_INTERVAL_MS = 60000;   // Vollbild für später zugeschaltete Empfänger
+  constexpr int MAX_RANGES = 24;                          // darüber lieber ein Vollbild
+  constexpr int PUBLISH_ATTEMPTS = 3;                     // beginPublish trotz Verbindung gescheitert: dann verwerfen
+  constexpr int HEADER_BYTES = 16;
+  constexpr int RANGE_HEADER_BYTES = 6;
+}
+
+enum ScreenshotType : uint8_t {
+  SCREENSHOT_FULL = 'F',
+  SCREENSHOT_DELTA = 'D'
+};
+
+// Aus MQTT-Anfragen (loop)
+void requestScreenshot();
+void setScreenshotStream(bool enabled);
+bool isScreenshotStreaming();
+
+// Render-Kontext, am Ende jedes Frames
+void updateScreenshotCapture();
+
+// Darf der Renderer den Layer neu aufnehmen? (Frame-Layer während des Sendens nicht)
+bool isLayerLentToScreenshot(const CachedLayer* layer);
+
+// loop(): fertige Nachricht schreiben und freigeben
+typedef bool (*ScreenshotWriteFunction)(const uint8_t* data, size_t length);
+bool screenshotReady();
+size_t screenshotMessageSize();
+bool writeScreenshotMessage(ScreenshotWriteFunction write);
+void releaseScreenshot(bool published);
+// Senden nicht begonnen: Nachricht bleibt für den nächsten Durchlauf liegen.
+// false = nach PUBLISH_ATTEMPTS Anläufen verworfen (wie releaseScreenshot(false))
+bool deferScreenshot();
+
+// Statistik
+struct ScreenshotStats {
+  unsigned long fullFrames = 0;
+  unsigned long deltas = 0;
+  unsigned long frameLayerReuses = 0;   // Home-Frame-Layer ohne neue Aufnahme gesendet
+  unsigned long failures = 0;           // Aufnahme oder Senden fehlgeschlagen
+  unsigned long retries = 0;            // beginPublish gescheitert, später erneut gesendet
+  unsigned long bytes = 0;
+  unsigned long maxCaptureMicros = 0;
+};
+
+extern ScreenshotStats screenshotStats;
+
+#endif // SCREENSHOT_H
@@ -102,10 +102,10 @@ int getTimeoutSensorCount() {
 void initializeSensorLayouts() {
   Serial.println("Initialisiere Sensor-Layouts...");
   
+  // Lage und Größe der Boxen kommen aus der Widget-Tabelle (config.h)
   struct SensorLayout {
     const char* label;
     const char* unit;
-    int x, y, w, h;
     bool hasProgressBar;
     bool hasIndicator;
     bool hasBidirectionalBar;
@@ -113,30 +113,31 @@ void initializeSensorLayouts() {
   
   // 3x3 Grid Layout - 8-Box Anordnung (untere rechte Ecke entfernt)
   const SensorLayout layouts[System::SENSOR_COUNT] = {
-    // Reihe 1: Markt/Finanzen-Gruppe                                                                ProgressBar  Indicator  BidirectionalBar
-    {"Oekostrom", "%",  10,  35, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, false, true,  false},   // [0]
-    {"Preis",     "ct", 115, 35, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, false, false, false},  // [1] 
-    {"Aktie",     "EUR", 220, 35, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, false, false, false},  // [2] Aktie nach oben, EUR statt E
-    // Reihe 2: Power/Charge-Gruppe  
-    {"Ladestand", "%",  10,  85, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true,  false, false},  // [3]
-    {"Verbrauch", "kW", 115, 85, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true, false, false}, // [4] Segmentierte Progress Bar
-    {"PV-Erzeugung", "W",  220, 85, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, true, false, false},  // [5] PV-Erzeugung mit Progress Bar
+    // Reihe 1: Markt/Finanzen-Gruppe     ProgressBar  Indicator  BidirectionalBar
+    {"Oekostrom", "%",   false, true,  false},   // [0]
+    {"Preis",     "ct",  false, false, false},   // [1]
+    {"Aktie",     "EUR", false, false, false},   // [2] Aktie nach oben, EUR statt E
+    // Reihe 2: Power/Charge-Gruppe
+    {"Ladestand", "%",   true,  false, false},   // [3]
+    {"Verbrauch", "kW",  true,  false, false},   // [4] Segmentierte Progress Bar
+    {"PV-Erzeugung", "W", true, false, false},   // [5] PV-Erzeugung mit Progress Bar
     // Reihe 3: Umwelt-Gruppe (ohne untere rechte Ecke)
-    {"Aussen",    "C",  10,  135, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, false, false, false}, // [6]
-    {"Wasser",    "C",  115, 135, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, false, true,  false}  // [7] Wasser nach links
+    {"Aussen",    "C",   false, false, false},   // [6]
+    {"Wasser",    "C",   false, true,  false}    // [7] Wasser nach links
   };
   
   for (int i = 0; i < System::SENSOR_COUNT; i++) {
     const auto& layout = layouts[i];
+    const WidgetLayout& box = WIDGETS[WIDGET_SENSOR_FIRST + i];
     auto& sensor = sensors[i];
     
     strncpy(sensor.label, layout.label, sizeof(sensor.label) - 1);
     strncpy(sensor.unit, layout.unit, sizeof(sensor.unit) - 1);
     
-    sensor.layout.x = layout.x;
-    sensor.layout.y = layout.y;
-    sensor.layout.w = layout.w;
-    sensor.layout.h = layout.h;
+    sensor.layout.x = box.x;
+    sensor.layout.y = box.y;
+    sensor.layout.w = box.w;
+    sensor.layout.h = box.h;
     sensor.layout.hasProgressBar = layout.hasProgressBar;
     sensor.layout.hasIndicator = layout.hasIndicator;
     sensor.layout.hasBidirectionalBar = layout.hasBidirectionalBar;
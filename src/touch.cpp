@@ -1,8 +1,18 @@
 #include "touch.h"
 #include "display.h"
 #include "utils.h"
+#include "frame_scheduler.h"
+#include "debug_hud.h"
+#include "render.h"
 #include <EEPROM.h>
 
+// TFT_eSPI (getTouch) schaltet TOUCH_CS als Ausgang: darf nicht auf dem
+// I2C-Bus des CST820 liegen (User_Setup.h bzw. build_flags der Umgebung)
+#ifdef TOUCH_CS
+static_assert(TOUCH_CS != TouchConfig::SDA_PIN && TOUCH_CS != TouchConfig::SCL_PIN,
+              "TOUCH_CS liegt auf dem I2C-Bus des CST820");
+#endif
+
 // ═══════════════════════════════════════════════════════════════════════════════
 //                              GLOBAL TOUCH MANAGER
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -79,6 +89,10 @@ bool TouchManager::initialize() {
   // Set initialized flag first
   isInitialized = true;
 
+  // Touch-Interrupt weckt loop() (Frame-Scheduler) statt 20x pro Sekunde zu pollen
+  int irqPin = (activeController == TOUCH_CST820_I2C) ? TouchConfig::INT_PIN : TouchConfig::XPT_IRQ_PIN;
+  attachInterrupt(digitalPinToInterrupt(irqPin), wakeFrameSchedulerFromISR, FALLING);
+
   // Initialize touch areas based on current sensor layout
   updateSensorTouchAreas();
 
@@ -125,7 +139,11 @@ TouchEvent TouchManager::update() {
   } else if (activeController == TOUCH_XPT2046_SPI) {
     // Use TFT_eSPI touch interface (like in example code)
     uint16_t x, y;
-    bool touched = tft.getTouch(&x, &y, 600); // 600 = pressure threshold
+    bool touched;
+    {
+      PanelLock panel;   // XPT2046 teilt sich den SPI-Bus mit dem Panel
+      touched = tft.getTouch(&x, &y, 600); // 600 = pressure threshold
+    }
 
     if (touched) {
       // Constrain to display bounds
@@ -201,6 +219,7 @@ TouchEvent TouchManager::update() {
 
     if (state.longPressTriggered) {
       event.type = TOUCH_UP;
+      event.afterLongPress = true;   // Aktion lief schon beim Long-Press
     } else if (pressDuration < TouchConfig::DOUBLE_TAP_MS) {
       // Check for double tap
       if (state.tapCount > 0 && (now - state.lastEventTime) < TouchConfig::DOUBLE_TAP_MS) {
@@ -236,34 +255,26 @@ void TouchManager::updateSensorTouchAreas() {
     return;
   }
 
-  // Get current anti-burnin offsets
+  // Touch-Bereiche = Sensor-Boxen aus der Widget-Tabelle (ohne Anti-Burnin-
+  // Offset). Der Offset wird erst beim Hit-Test angewendet, aus derselben
+  // Quelle wie beim Zeichnen - nach einer Verschiebung muss hier nichts
+  // nachgeführt werden.
+  for (int i = 0; i < System::SENSOR_COUNT; i++) {
+    const WidgetLayout& box = WIDGETS[WIDGET_SENSOR_FIRST + i];
+    bool active = touchAreas[i].isActive;
+    touchAreas[i] = TouchArea(box.x, box.y, box.w, box.h, i);
+    touchAreas[i].isActive = active;
+  }
+}
+
+int TouchManager::findTouchedSensor(const TouchPoint& point) {
+  // Gleicher Offset wie beim Zeichnen der Boxen (drawSensorBox)
   extern AntiBurninManager antiBurnin;
   int offsetX = antiBurnin.getOffsetX();
   int offsetY = antiBurnin.getOffsetY();
 
-  // Touch-Bereiche basierend auf tatsächlichen Sensor-Positionen aus sensors.cpp
-  // Touch-Bereiche passend zu den tatsächlichen Sensor-Boxen definiert
-  // WICHTIG: Anti-Burnin-Offsets werden angewendet, damit Touch-Bereiche mit verschobenem Display übereinstimmen
-
-  // Reihe 1: Markt/Finanzen-Gruppe
-  touchAreas[0] = TouchArea(10 + offsetX, 35 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 0);   // Ökostrom
-  touchAreas[1] = TouchArea(115 + offsetX, 35 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 1);  // Preis
-  touchAreas[2] = TouchArea(220 + offsetX, 35 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 2);  // Aktie
-
-  // Reihe 2: Power/Charge-Gruppe
-  touchAreas[3] = TouchArea(10 + offsetX, 85 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 3);   // Ladestand
-  touchAreas[4] = TouchArea(115 + offsetX, 85 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 4);  // Verbrauch
-  touchAreas[5] = TouchArea(220 + offsetX, 85 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 5);  // PV-Erzeugung
-
-  // Reihe 3: Umwelt-Gruppe
-  touchAreas[6] = TouchArea(10 + offsetX, 135 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 6);  // Außentemperatur
-  touchAreas[7] = TouchArea(115 + offsetX, 135 + offsetY, Layout::SENSOR_BOX_WIDTH, Layout::SENSOR_BOX_HEIGHT, 7); // Wassertemperatur
-
-}
-
-int TouchManager::findTouchedSensor(const TouchPoint& point) {
   for (int i = 0; i < System::SENSOR_COUNT; i++) {
-    if (touchAreas[i].contains(point)) {
+    if (touchAreas[i].contains(point, offsetX, offsetY)) {
       return i;
     }
   }
@@ -444,12 +455,13 @@ bool TouchManager::updateCalibration() {
 }
 
 void TouchManager::showCalibrationPoint() {
-  extern TFT_eSPI tft;
+  extern ProfiledTFT tft;
   extern AntiBurninManager antiBurnin;
 
   if (currentCalPoint >= 4) return;
 
   CalibrationPoint& point = calPoints[currentCalPoint];
+  PanelLock panel;
   tft.fillScreen(Colors::BG_MAIN);
   tft.setTextColor(Colors::TEXT_MAIN);
 
@@ -499,11 +511,14 @@ bool TouchManager::handleCalibrationTouch() {
                  currentCalPoint + 1, point.screenX, point.screenY,
                  point.touchX, point.touchY);
 
-    extern TFT_eSPI tft;
+    extern ProfiledTFT tft;
     extern AntiBurninManager antiBurnin;
     int offsetX = antiBurnin.getOffsetX();
 
-    tft.fillCircle(point.screenX + offsetX, point.screenY, 12, Colors::STATUS_GREEN);
+    {
+      PanelLock panel;
+      tft.fillCircle(point.screenX + offsetX, point.screenY, 12, Colors::STATUS_GREEN);
+    }
     delay(800);
 
     currentCalPoint++;
@@ -561,16 +576,19 @@ void TouchManager::calculateAdvancedCalibration() {
 }
 
 void TouchManager::showCalibrationComplete() {
-  extern TFT_eSPI tft;
+  extern ProfiledTFT tft;
   extern AntiBurninManager antiBurnin;
   int offsetX = antiBurnin.getOffsetX();
 
-  tft.fillScreen(Colors::BG_MAIN);
-  tft.setTextColor(Colors::STATUS_GREEN);
-  tft.drawString("Kalibrierung erfolgreich!", 10 + offsetX, 50, 2);
+  {
+    PanelLock panel;
+    tft.fillScreen(Colors::BG_MAIN);
+    tft.setTextColor(Colors::STATUS_GREEN);
+    tft.drawString("Kalibrierung erfolgreich!", 10 + offsetX, 50, 2);
 
-  tft.setTextColor(Colors::TEXT_MAIN);
-  tft.drawString("Touch-Genauigkeit optimiert", 10 + offsetX, 90, 1);
+    tft.setTextColor(Colors::TEXT_MAIN);
+    tft.drawString("Touch-Genauigkeit optimiert", 10 + offsetX, 90, 1);
+  }
 
   delay(3000);
 }
@@ -591,7 +609,7 @@ void onSensorTouched(int sensorIndex) {
   if (sensorIndex < 0 || sensorIndex >= System::SENSOR_COUNT) return;
 
   SensorData& sensor = sensors[sensorIndex];
-  renderManager.markSensorChanged(sensorIndex);
+  renderManager.markSensorTouched(sensorIndex);
   sensor.touchCount++;
   sensor.lastTouchTime = millis();
 }
@@ -623,7 +641,13 @@ void onLongPress(const TouchPoint& point) {
   // Check if long press is in empty area (not on sensor)
   int sensorIndex = touchManager.findTouchedSensor(point);
   if (sensorIndex == -1) {
-    // Long press in empty area - disabled auto calibration for now
+    // Freie Ecke auf dem Home-Screen: Debug-HUD ein/aus
+    extern AntiBurninManager antiBurnin;
+    if (currentMode == HOME_SCREEN &&
+        WIDGETS[WIDGET_SETTINGS].contains(point.x, point.y, antiBurnin.getOffsetX(), antiBurnin.getOffsetY())) {
+      toggleDebugHud();
+    }
+    // Sonst: Auto-Kalibrierung vorerst deaktiviert
   } else {
     // Long press on sensor - sensor-specific action
     // Future: Open sensor settings
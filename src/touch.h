@@ -72,8 +72,9 @@ struct TouchEvent {
   TouchPoint startPoint;  // For gestures
   unsigned long timestamp;
   int sensorIndex;        // Which sensor box was touched (-1 if none)
+  bool afterLongPress;    // TOUCH_UP nach ausgelöstem Long-Press (kein Klick)
 
-  TouchEvent() : type(TOUCH_NONE), timestamp(0), sensorIndex(-1) {}
+  TouchEvent() : type(TOUCH_NONE), timestamp(0), sensorIndex(-1), afterLongPress(false) {}
 };
 
 struct TouchState {
@@ -100,9 +101,14 @@ struct TouchArea {
     : x(x), y(y), width(w), height(h), sensorIndex(index), isActive(true) {}
 
   bool contains(const TouchPoint& point) const {
+    return contains(point, 0, 0);
+  }
+
+  // Bereich um (offsetX, offsetY) verschoben prüfen (Anti-Burnin)
+  bool contains(const TouchPoint& point, int offsetX, int offsetY) const {
     return point.isValid &&
-           point.x >= x && point.x < (x + width) &&
-           point.y >= y && point.y < (y + height) &&
+           point.x >= x + offsetX && point.x < (x + offsetX + width) &&
+           point.y >= y + offsetY && point.y < (y + offsetY + height) &&
            isActive;
   }
 };
@@ -179,6 +185,8 @@ public:
 
   // Getters
   bool isTouch() const { return state.isPressed; }
+  // Loslassen, Long-Press und Doppeltipp-Fenster lösen keinen Interrupt aus
+  bool needsPolling() const { return state.isPressed || state.tapCount > 0 || calibrationActive; }
   TouchPoint getCurrentTouch() const { return state.currentPoint; }
   bool hasValidCalibration() const { return hasCalibration; }
   int findTouchedSensor(const TouchPoint& point);
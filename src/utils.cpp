@@ -1,4 +1,13 @@
 #include "utils.h"
+#include "render.h"
+#include "display_list.h"
+#include "palette_buffer.h"
+#include "glyph_cache.h"
+#include "frame_scheduler.h"
+#include "display.h"
+#include "backlight.h"
+#include "debug_hud.h"
+#include "screenshot.h"
 #include <WiFi.h>  // Für WiFi.localIP() und WiFi-Funktionen
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -138,16 +147,80 @@ void logMemoryStatus() {
 
 void logPerformanceStats() {
   auto& perf = systemStatus.performance;
-  unsigned long total = perf.totalRedraws + perf.skippedRedraws;
   
   Serial.println();
   Serial.println("PERFORMANCE-STATISTIKEN:");
   Serial.printf("   CPU-Last (geglättet): %.1f%%\n", systemStatus.cpuUsageSmoothed);
   Serial.printf("   Redraws total: %lu\n", perf.totalRedraws);
-  Serial.printf("   Redraws übersprungen: %lu\n", perf.skippedRedraws);
-  Serial.printf("   Render-Effizienz: %.1f%%\n", perf.redrawEfficiency);
+  Serial.printf("   Kacheln übersprungen: %llu von %llu (%.1f%%, Inhalt unverändert)\n",
+                (unsigned long long)perf.tilesSkipped,
+                (unsigned long long)(perf.tilesPushed + perf.tilesSkipped), perf.tileSkipPercent());
+  Serial.printf("   Pixel übertragen: %llu\n", (unsigned long long)perf.pixelsPushed);
+  Serial.printf("   Pixel eingespart: %llu (%.1f%% ggü. Vollbild-Redraw)\n",
+                (unsigned long long)perf.pixelsSaved, perf.pixelSavingsPercent());
+  Serial.printf("   Sensor-Boxen per Sprite: %lu (direkt: %lu)\n",
+                spriteRenderStats.spritePushes, spriteRenderStats.directFallbacks);
+  Serial.printf("   Vollbilder per Band-Renderer: %lu (%lu Bänder%s)\n",
+                spriteRenderStats.bandFrames, spriteRenderStats.bandPushes,
+                spriteRenderStats.bandAllocationFailed ? ", Sprite fehlt" : "");
+  Serial.printf("   Display-Liste: %lu Vollbild-Anfragen per Diff (%lu unverändert), %lu Vollbilder, max %d Befehle%s\n",
+                displayListStats.diffedRedraws, displayListStats.unchangedRedraws,
+                displayListStats.fullRedraws, displayListStats.maxCommands,
+                displayListStats.overflows > 0 ? " (Überlauf!)" : "");
+  Serial.printf("   Chrome-Layer: %lu Aufnahmen (max %d Läufe%s), %lu Boxen und %lu Vollbilder daraus\n",
+                homeChromeLayer.captures, homeChromeLayer.maxRuns,
+                homeChromeLayer.overflows > 0 ? ", Überlauf!" : "",
+                cachedLayerStats.composedBoxes, cachedLayerStats.composedFrames);
+  Serial.printf("   Home-Vollbild-Cache: %lu Aufnahmen (max %d Läufe%s), %lu Rückkehr per Blit (%lu Widgets nachgezogen)\n",
+                homeFrameLayer.captures, homeFrameLayer.maxRuns,
+                homeFrameLayer.overflows > 0 ? ", Überlauf!" : "",
+                cachedLayerStats.restoredFrames, cachedLayerStats.restoredWidgets);
+  Serial.printf("   Glyph-Cache: %d%% Treffer (%lu/%lu), %lu verdrängt, %lu ohne Cache, max %d Läufe, %lu aus Font-Subset\n",
+                glyphCacheStats.hitRatePercent(), glyphCacheStats.hits,
+                glyphCacheStats.hits + glyphCacheStats.misses, glyphCacheStats.evictions,
+                glyphCacheStats.uncacheable, glyphCacheStats.maxRuns, glyphCacheStats.subsetHits);
+  Serial.printf("   Chart-Cache: %lu Aufnahmen (%d Bit, %u Bytes, max %d Farben%s), %lu Vollbilder daraus\n",
+                detailLayerCache.captures, detailLayerCache.bitsPerPixel(),
+                (unsigned)detailLayerCache.bytesUsed(), detailLayerCache.maxColors,
+                detailLayerCache.overflows > 0 ? ", Überlauf!" : "", detailLayerCache.restores);
+  Serial.printf("   Render-Task: %s, %lu Frames (zusammengefasst: %lu, verworfen: %lu)\n",
+                isRenderTaskRunning() ? "aktiv" : "aus", renderTaskStats.frames,
+                renderTaskStats.coalescedRequests, renderTaskStats.droppedRequests);
+  Serial.printf("   Frame-Zeit: %lu us (max %lu us), Queue-Latenz max %lu ms, DMA-Pushes: %lu, Panel freigegeben: %lu\n",
+                renderTaskStats.lastFrameMicros, renderTaskStats.maxFrameMicros,
+                renderTaskStats.maxQueueLatencyMs, renderTaskStats.dmaPushes, renderTaskStats.panelYields);
+  Serial.printf("   Frame-Scheduler: %lu Durchläufe (%lu geweckt: Touch %lu, MQTT %lu), %lu%% geschlafen, Deadline verpasst: %lu (max %lu ms)\n",
+                frameSchedulerStats.wakeups, frameSchedulerStats.eventWakeups,
+                frameSchedulerStats.touchWakeups, frameSchedulerStats.networkWakeups,
+                millis() > 0 ? (unsigned long)((uint64_t)frameSchedulerStats.sleptMs * 100 / millis()) : 0UL,
+                renderTaskStats.missedDeadlines, renderTaskStats.maxLatenessMs);
+  Serial.printf("   Frame-Budget: %lu/%lu Frames über %lu us (max %lu us), %lu verschoben (%lu Widgets)\n",
+                frameBudgetStats.exceededFrames, frameBudgetStats.budgetedFrames,
+                FrameBudgetConfig::BUDGET_US, frameBudgetStats.maxFrameMicros,
+                frameBudgetStats.deferredFrames, frameBudgetStats.deferredWidgets);
+  if (PanelConfig::COUNT > 1) {
+    Serial.printf("   Panels: %d, %lu Szenen (%lu verschränkt), %lu CS-Wechsel\n",
+                  PanelConfig::COUNT, panelStats.sceneFrames, panelStats.interleavedFrames,
+                  panelStats.panelSwitches);
+  }
+  Serial.printf("   Segment-Balken: %lu Delta (%lu px), %lu voll, %lu unverändert\n",
+                segmentBarStats.deltaPushes, segmentBarStats.deltaPixels,
+                segmentBarStats.fullPushes, segmentBarStats.unchanged);
   Serial.printf("   Uptime: %s\n", formatUptime(systemStatus.uptime).c_str());
   Serial.printf("   LDR-Wert: %d (geglättet: %d)\n", systemStatus.ldrValue, systemStatus.ldrValueSmoothed);
+  Serial.printf("   Backlight: %d/%d (Pegel %d‰), Nachtmodus %s, %lu Nächte, %lu Weckungen, %lu PWM-Writes\n",
+                backlightStats.duty, BacklightConfig::MAX_DUTY, backlightStats.level,
+                isNightMode() ? "an" : "aus", backlightStats.nightEntries,
+                backlightStats.wakeups, backlightStats.dutyWrites);
+  Serial.printf("   Debug-HUD: %s, %lu Umschaltungen, %lu Auffrischungen, max Frame %lu us, max Loop %lu us\n",
+                isDebugHudVisible() ? "an" : "aus", debugHudStats.toggles, debugHudStats.refreshes,
+                debugHudStats.maxFrameMicros, debugHudStats.maxLoopMicros);
+  if (screenshotStats.fullFrames + screenshotStats.deltas + screenshotStats.failures > 0) {
+    Serial.printf("   Screenshots: %lu Vollbilder, %lu Deltas (%lu aus dem Frame-Layer), %lu Bytes, %lu Fehler, %lu Wiederholungen, max %lu us Aufnahme\n",
+                  screenshotStats.fullFrames, screenshotStats.deltas, screenshotStats.frameLayerReuses,
+                  screenshotStats.bytes, screenshotStats.failures, screenshotStats.retries,
+                  screenshotStats.maxCaptureMicros);
+  }
   
   logMemoryStatus();
   Serial.println();
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Screenshots des Displays (MQTT-Topic display/screenshot) in PNGs umwandeln.
+
+Format siehe src/screenshot.h. Vollbilder ('F') ersetzen das Bild, Deltas
+('D') überschreiben die enthaltenen Zeilenbereiche des vorherigen Bildes.
+
+Aus Dateien (z.B. mit mosquitto_sub -t display/screenshot -C 1 > shot.bin):
+    tools/decode_screenshot.py shot.bin [delta1.bin ...] -o screenshots/
+
+Direkt vom Broker (benötigt paho-mqtt):
+    tools/decode_screenshot.py --mqtt 192.168.1.10 -o screenshots/
+    tools/decode_screenshot.py --mqtt 192.168.1.10 --stream 30 -o screenshots/
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+REQUEST_TOPIC = "display/screenshot/request"
+DATA_TOPIC = "display/screenshot"
+HEADER = struct.Struct("<4sBBHHHHH")
+RANGE_HEADER = struct.Struct("<HHH")
+LENGTH_BITS = 11
+
+
+class Screen:
+    """Aktuelles Bild als Zeilen von RGB565-Werten."""
+
+    def __init__(self):
+        self.width = 0
+        self.height = 0
+        self.rows = []
+        self.sequence = None
+
+    def apply(self, message):
+        magic, kind, palette_size, width, height, sequence, range_count, _ = HEADER.unpack_from(message)
+        if magic != b"SHS1":
+            raise ValueError("kein Screenshot (Kennung %r)" % magic)
+        kind = chr(kind)
+        if kind == "D":
+            if self.sequence is None or (self.sequence + 1) & 0xFFFF != sequence:
+                raise ValueError("Delta %d ohne passendes Vorgängerbild" % sequence)
+        elif kind == "F":
+            self.width, self.height = width, height
+            self.rows = [[0] * width for _ in range(height)]
+        else:
+            raise ValueError("unbekannter Typ %r" % kind)
+
+        offset = HEADER.size
+        palette = struct.unpack_from("<%dH" % palette_size, message, offset)
+        offset += 2 * palette_size
+
+        for _ in range(range_count):
+            first_row, row_count, run_count = RANGE_HEADER.unpack_from(message, offset)
+            offset += RANGE_HEADER.size
+            runs = struct.unpack_from("<%dH" % run_count, message, offset)
+            offset += 2 * run_count
+
+            row, x = first_row, 0
+            for run in runs:
+                color = palette[run >> LENGTH_BITS]
+                length = run & ((1 << LENGTH_BITS) - 1)
+                self.rows[row][x:x + length] = [color] * length
+                x += length
+                if x >= self.width:
+                    row, x = row + 1, 0
+            if row != first_row + row_count or x != 0:
+                raise ValueError("Bereich ab Zeile %d unvollständig" % first_row)
+
+        self.sequence = sequence
+        return kind, sequence
+
+    def write_png(self, path):
+        raw = bytearray()
+        for row in self.rows:
+            raw.append(0)   # Filter: keiner
+            for color in row:
+                r, g, b = (color >> 11) & 0x1F, (color >> 5) & 0x3F, color & 0x1F
+                raw += bytes(((r * 527 + 23) >> 6, (g * 259 + 33) >> 6, (b * 527 + 23) >> 6))
+
+        def chunk(tag, data):
+            body = tag + data
+            return struct.pack(">I", len(data)) + body + struct.pack(">I", zlib.crc32(body) & 0xFFFFFFFF)
+
+        with open(path, "wb") as out:
+            out.write(b"\x89PNG\r\n\x1a\n")
+            out.write(chunk(b"IHDR", struct.pack(">IIBBBBB", self.width, self.height, 8, 2, 0, 0, 0)))
+            out.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+            out.write(chunk(b"IEND", b""))
+
+
+def output_path(args, sequence, single):
+    if single and args.output.endswith(".png"):
+        return args.output
+    os.makedirs(args.output, exist_ok=True)
+    return os.path.join(args.output, "screenshot_%05d.png" % sequence)
+
+
+def decode_files(args):
+    screen = Screen()
+    for name in args.files:
+        with open(name, "rb") as f:
+            kind, sequence = screen.apply(f.read())
+        path = output_path(args, sequence, len(args.files) == 1)
+        screen.write_png(path)
+        print("%s: %s #%d -> %s" % (name, "Vollbild" if kind == "F" else "Delta", sequence, path))
+
+
+def receive_mqtt(args):
+    try:
+        import paho.mqtt.client as mqtt
+    except ImportError:
+        sys.exit("--mqtt benötigt paho-mqtt (pip install paho-mqtt)")
+
+    host, _, port = args.mqtt.partition(":")
+    screen = Screen()
+    received = [0]
+    wanted = max(1, args.stream)
+
+    def on_connect(client, userdata, flags, rc, *extra):
+        client.subscribe(DATA_TOPIC)
+        client.publish(REQUEST_TOPIC, "stream" if args.stream else "full")
+
+    def on_message(client, userdata, message):
+        try:
+            kind, sequence = screen.apply(message.payload)
+        except ValueError as error:
+            print("übersprungen: %s" % error)
+            return
+        path = output_path(args, sequence, not args.stream)
+        screen.write_png(path)
+        print("%s #%d (%d Bytes) -> %s" % ("Vollbild" if kind == "F" else "Delta", sequence,
+                                           len(message.payload), path))
+        received[0] += 1
+        if received[0] >= wanted:
+            if args.stream:
+                client.publish(REQUEST_TOPIC, "stop")
+            client.disconnect()
+
+    client = mqtt.Client()
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_connect = on_connect
+    client.on_message = on_message
+    client.connect(host, int(port or 1883))
+    client.loop_forever()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("files", nargs="*", help="Nachrichten in Empfangsreihenfolge")
+    parser.add_argument("-o", "--output", default=".", help="Verzeichnis oder .png (eine Nachricht)")
+    parser.add_argument("--mqtt", metavar="HOST[:PORT]", help="Screenshot beim Gerät anfordern")
+    parser.add_argument("--stream", type=int, default=0, metavar="N", help="N Nachrichten streamen")
+    parser.add_argument("--user", help="MQTT-Benutzer")
+    parser.add_argument("--password", help="MQTT-Passwort")
+    args = parser.parse_args()
+
+    if args.mqtt:
+        receive_mqtt(args)
+    elif args.files:
+        decode_files(args)
+    else:
+        parser.error("Dateien oder --mqtt angeben")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,546 @@
+#!/usr/bin/env python3
+"""Font-Subset zur Build-Zeit (PlatformIO: extra_scripts = pre:tools/font_subset.py).
+
+Durchsucht die Quellen der Umgebung nach den Fonts und Zeichen, die das UI
+wirklich zeichnet, und
+  - erzeugt $BUILD_DIR/font_subset/font_subset.h: constexpr-Läufe der
+    genutzten Zeichen von Font 2 und 4 (Format siehe src/glyph_cache.h),
+    gelesen aus Fonts/Font16.c und Fonts/Font32rle.c von TFT_eSPI,
+    und setzt FONT_SUBSET,
+  - entfernt LOAD_FONTn/SMOOTH_FONT/LOAD_GFXFF ungenutzter Fonts aus den
+    build_flags (nur wenn die Umgebung ihr Setup mit USER_SETUP_LOADED
+    selbst mitbringt),
+  - meldet je Umgebung die eingesparten Bytes (Konsole und report.txt).
+
+Erkannt werden Fonts nur als Zahl-Literal (drawString(text, x, y, 4),
+drawCachedString(gfx, text, x, y, 2, color), setTextFont(2), ...); die
+Zeichen aus String-Literalen dieser Aufrufe, RUNTIME_CHARACTERS und der
+Option custom_font_subset_chars. Zeichen außerhalb des Subsets zeichnet der
+Glyph-Cache wie bisher über TFT_eSPI.
+
+Vor dem Setzen von FONT_SUBSET wird der Header Pixel für Pixel gegen einen
+eigenen Nachbau von TFT_eSPI::drawChar() geprüft; bei Abweichungen bleibt
+FONT_SUBSET aus und der Build meldet die Zeichen.
+
+Ohne PlatformIO (z.B. zum Prüfen):
+    tools/font_subset.py --tft-espi .pio/libdeps/esp32dev/TFT_eSPI --src src \\
+        --chars ctEURkWC -o .pio/build/esp32dev/font_subset
+    tools/font_subset.py --tft-espi .pio/libdeps/esp32dev/TFT_eSPI \\
+        -o .pio/build/esp32dev/font_subset --verify
+"""
+
+import argparse
+import fnmatch
+import os
+import re
+import sys
+
+# Ziffern und Trennzeichen formatierter Werte (Uhrzeit, Messwerte)
+RUNTIME_CHARACTERS = "0123456789 .,:+-%"
+
+# Font -> (Datei, Tabellen-Suffix, Kodierung, Zellhöhe falls das .h fehlt)
+TFT_FONTS = {
+    2: ("Font16", "f16", "bitmap", 16),
+    4: ("Font32rle", "f32", "rle", 26),
+    6: ("Font64rle", "f64", "rle", 48),
+    7: ("Font7srle", "f7s", "rle", 48),
+    8: ("Font72rle", "f72", "rle", 75),
+}
+SUBSET_FONTS = (2, 4)
+FIRST_CHARACTER = 32
+CHARACTER_COUNT = 96
+
+# Schalter im TFT_eSPI-Setup -> Font
+FONT_SWITCHES = {
+    "LOAD_FONT2": 2,
+    "LOAD_FONT4": 4,
+    "LOAD_FONT6": 6,
+    "LOAD_FONT7": 7,
+    "LOAD_FONT8": 8,
+    "SMOOTH_FONT": "smooth",
+    "LOAD_GFXFF": "gfx",
+}
+
+# Aufruf -> (Argumente, Index des Fonts, Index des Texts oder None)
+FONT_CALLS = {
+    "drawString": (4, 3, 0),
+    "drawCentreString": (4, 3, 0),
+    "drawRightString": (4, 3, 0),
+    "drawCachedString": (6, 4, 1),
+    "drawNumber": (4, 3, None),
+    "drawFloat": (5, 4, None),
+    "drawChar": (4, 3, None),
+    "textWidth": (2, 1, 0),
+    "fontHeight": (1, 0, None),
+    "setTextFont": (1, 0, None),
+}
+
+SOURCE_EXTENSIONS = (".c", ".cpp", ".h", ".hpp", ".ino")
+DEFAULT_SRC_FILTER = "+<*> -<.git/> -<.svn/>"
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+#                              QUELLEN DURCHSUCHEN
+# ═══════════════════════════════════════════════════════════════════════════════
+
+TOKEN = re.compile(r'"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'|//[^\n]*|/\*.*?\*/', re.S)
+CALL = re.compile(r"\b(%s|loadFont|setFreeFont)\s*\(" % "|".join(FONT_CALLS))
+
+
+def strip_comments(code):
+    return TOKEN.sub(lambda m: " " if m.group(0)[0] == "/" else m.group(0), code)
+
+
+def call_arguments(code, start):
+    """Argumente des Aufrufs, dessen '(' bei start liegt (oberste Ebene)."""
+    args, depth, current = [], 0, start + 1
+    position = start
+    while position < len(code):
+        m = TOKEN.match(code, position)
+        if m:
+            position = m.end()
+            continue
+        c = code[position]
+        if c in "([{":
+            depth += 1
+        elif c in ")]}":
+            depth -= 1
+            if depth == 0:
+                args.append(code[current:position].strip())
+                return [a for a in args if a]
+        elif c == "," and depth == 1:
+            args.append(code[current:position].strip())
+            current = position + 1
+        position += 1
+    return []
+
+
+def unescape(literal):
+    """Inhalt eines C-String-Literals (nur die einfachen Escapes)."""
+    body = literal[1:-1]
+    return re.sub(r"\\(.)", lambda m: {"n": "\n", "t": "\t", "0": ""}.get(m.group(1), m.group(1)), body)
+
+
+def scan_sources(paths):
+    """Genutzte Fonts und die Zeichen, die in Font 2/4 als Literal gezeichnet werden."""
+    fonts, characters = set(), set()
+    for path in paths:
+        with open(path, encoding="utf-8", errors="replace") as f:
+            code = strip_comments(f.read())
+        for m in CALL.finditer(code):
+            name = m.group(1)
+            if name == "loadFont":
+                fonts.add("smooth")
+                continue
+            if name == "setFreeFont":
+                fonts.add("gfx")
+                continue
+            args = call_arguments(code, m.end() - 1)
+            count, font_index, text_index = FONT_CALLS[name]
+            if len(args) != count or not args[font_index].isdigit():
+                continue
+            font = int(args[font_index])
+            fonts.add(font)
+            if font in SUBSET_FONTS and text_index is not None:
+                text = args[text_index]
+                if text.startswith('"') and text.endswith('"'):
+                    characters.update(unescape(text))
+    return fonts, characters
+
+
+def source_files(src_dir, src_filter):
+    """Dateien einer Umgebung nach build_src_filter (+<muster> / -<muster>, relativ zu src)."""
+    selected = set()
+    for sign, pattern in re.findall(r"([+-])<([^>]*)>", src_filter or DEFAULT_SRC_FILTER):
+        base = os.path.normpath(os.path.join(src_dir, pattern.rstrip("/") or "."))
+        if os.path.isfile(base):
+            matches = {base}
+        elif os.path.isdir(base):
+            matches = {os.path.join(root, name) for root, _, names in os.walk(base) for name in names}
+        else:
+            directory, mask = os.path.split(base)
+            matches = set()
+            for root, _, names in os.walk(directory if os.path.isdir(directory) else src_dir):
+                matches.update(os.path.join(root, n) for n in names if fnmatch.fnmatch(n, mask))
+        if sign == "+":
+            selected |= matches
+        else:
+            selected -= matches
+    sources = sorted(p for p in selected if p.endswith(SOURCE_EXTENSIONS))
+
+    # Projekt-Header, die die Quellen einbinden (Layout-Tabellen, Inline-Code)
+    for path in list(sources):
+        directory = os.path.dirname(path)
+        with open(path, encoding="utf-8", errors="replace") as f:
+            for include in re.findall(r'#include\s+"([^"]+)"', f.read()):
+                header = os.path.normpath(os.path.join(directory, include))
+                if os.path.isfile(header) and header not in sources:
+                    sources.append(header)
+    return sources
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+#                              TFT_eSPI-FONTS LESEN
+# ═══════════════════════════════════════════════════════════════════════════════
+
+ARRAY = re.compile(r"(\w+)\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}", re.S)
+
+
+class TftFont:
+    def __init__(self, directory, font):
+        name, suffix, self.encoding, height = TFT_FONTS[font]
+        with open(os.path.join(directory, "Fonts", name + ".c"), encoding="latin-1") as f:
+            code = strip_comments(f.read())
+        header = os.path.join(directory, "Fonts", name + ".h")
+        if os.path.isfile(header):
+            with open(header, encoding="latin-1") as f:
+                m = re.search(r"chr_hgt_%s\s+(\d+)" % suffix, f.read())
+                height = int(m.group(1)) if m else height
+        self.height = height
+
+        arrays = {m.group(1): [v.strip() for v in m.group(2).split(",") if v.strip()]
+                  for m in ARRAY.finditer(code)}
+        self.widths = [int(v, 0) for v in arrays["widtbl_" + suffix]]
+        names = arrays["chrtbl_" + suffix]
+        self.glyphs = [[int(v, 0) for v in arrays[n]] for n in names]
+
+        # Flash der vollständigen Tabellen: Zeichendaten (geteilte einmal),
+        # Breiten und Zeiger (4 Byte)
+        distinct = {n: len(arrays[n]) for n in names}
+        self.size = sum(distinct.values()) + len(self.widths) + 4 * len(names)
+
+    def runs(self, code):
+        """Waagrechte Läufe (x, y, Länge) und Vorschub wie TFT_eSPI::drawChar()."""
+        index = code - FIRST_CHARACTER
+        width, data = self.widths[index], self.glyphs[index]
+        rows = [[] for _ in range(self.height)]
+
+        if self.encoding == "bitmap":
+            bytes_per_row = (width + 6) // 8
+            for y in range(self.height):
+                for k in range(bytes_per_row):
+                    line = data[bytes_per_row * y + k] if bytes_per_row * y + k < len(data) else 0
+                    rows[y].extend(k * 8 + bit for bit in range(8) if line & (0x80 >> bit))
+        else:
+            # RLE: Bit 7 gesetzt = (n & 0x7F) + 1 Vordergrund-Pixel, sonst n + 1 Hintergrund
+            pixel, total = 0, width * self.height
+            for value in data:
+                if pixel >= total:
+                    break
+                length = (value & 0x7F) + 1
+                if value & 0x80:
+                    for p in range(pixel, min(pixel + length, total)):
+                        rows[p // width].append(p % width)
+                pixel += length
+
+        runs = []
+        for y, xs in enumerate(rows):
+            for x in sorted(xs):
+                if runs and runs[-1][1] == y and runs[-1][0] + runs[-1][2] == x:
+                    runs[-1][2] += 1
+                else:
+                    runs.append([x, y, 1])
+        return [tuple(r) for r in runs], width
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+#                              HEADER ERZEUGEN
+# ═══════════════════════════════════════════════════════════════════════════════
+
+GLYPH_BYTES = 4   # SubsetGlyph
+RUN_BYTES = 3     # GlyphRun
+
+
+def describe(code):
+    # Kein Backslash am Zeilenende: würde die nächste Zeile in den Kommentar ziehen
+    return "Backslash" if code == 92 else "'%c'" % code
+
+
+def build_header(tft_dir, characters):
+    codes = sorted(c for c in {ord(ch) for ch in characters}
+                   if FIRST_CHARACTER <= c < FIRST_CHARACTER + CHARACTER_COUNT)
+    lines = [
+        "// Automatisch erzeugt von tools/font_subset.py - nicht bearbeiten",
+        "#ifndef FONT_SUBSET_TABLES_H",
+        "#define FONT_SUBSET_TABLES_H",
+        "",
+        "namespace FontSubset {",
+    ]
+    table_bytes = full_bytes = 0
+    entries = []
+
+    for font in SUBSET_FONTS:
+        tft = TftFont(tft_dir, font)
+        index = [0] * CHARACTER_COUNT
+        glyphs, runs = [], []
+        for code in codes:
+            glyph_runs, advance = tft.runs(code)
+            if len(glyph_runs) > 255 or max([r[0] + r[2] for r in glyph_runs] + [advance]) > 255:
+                continue   # passt nicht ins Format: bleibt bei TFT_eSPI
+            glyphs.append((len(runs), len(glyph_runs), advance, code))
+            runs.extend(glyph_runs)
+            index[code - FIRST_CHARACTER] = len(glyphs)
+        size = CHARACTER_COUNT + GLYPH_BYTES * len(glyphs) + RUN_BYTES * len(runs)
+        table_bytes += size
+        full_bytes += tft.size
+        entries.append("    {%d, FONT%d_INDEX, FONT%d_GLYPHS, FONT%d_RUNS}," % (font, font, font, font))
+
+        lines.append("")
+        lines.append("  // Font %d: %d Zeichen, %d Läufe, %d Bytes (vollständig %d Bytes)"
+                     % (font, len(glyphs), len(runs), size, tft.size))
+        lines.append("  constexpr uint8_t FONT%d_INDEX[%d] = {   // Zeichen - %d -> Glyph + 1, 0 = nicht im Subset"
+                     % (font, CHARACTER_COUNT, FIRST_CHARACTER))
+        for row in range(0, CHARACTER_COUNT, 16):
+            lines.append("    " + " ".join("%d," % v for v in index[row:row + 16]))
+        lines.append("  };")
+        lines.append("  constexpr SubsetGlyph FONT%d_GLYPHS[] = {" % font)
+        for first, count, advance, code in glyphs:
+            lines.append("    {%d, %d, %d},   // %s" % (first, count, advance, describe(code)))
+        lines.append("  };")
+        lines.append("  constexpr GlyphRun FONT%d_RUNS[] = {" % font)
+        for row in range(0, len(runs), 8):
+            lines.append("    " + " ".join("{%d, %d, %d}," % r for r in runs[row:row + 8]))
+        lines.append("  };")
+
+    lines += [
+        "",
+        "  constexpr SubsetFont FONTS[] = {",
+    ] + entries + [
+        "  };",
+        "  constexpr int CHARACTERS = %d;" % len(codes),
+        "  constexpr unsigned long TABLE_BYTES = %d;" % table_bytes,
+        "  constexpr unsigned long FULL_BYTES = %d;       // Font 2 und 4 in TFT_eSPI" % full_bytes,
+        "}",
+        "",
+        "#endif // FONT_SUBSET_TABLES_H",
+        "",
+    ]
+    return "\n".join(lines), len(codes), table_bytes, full_bytes
+
+
+def write_if_changed(path, text):
+    if os.path.isfile(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+def font_sizes(tft_dir, fonts):
+    sizes = {}
+    for font in fonts:
+        try:
+            sizes[font] = TftFont(tft_dir, font).size
+        except (OSError, KeyError):
+            sizes[font] = None
+    return sizes
+
+
+def format_size(size):
+    return "%.1f KB" % (size / 1024.0) if size is not None else "?"
+
+
+def generate(tft_dir, sources, extra_characters, output_dir):
+    """Header schreiben; liefert (genutzte Fonts, Berichtszeilen, Subset-Bytes)."""
+    fonts, characters = scan_sources(sources)
+    characters |= set(RUNTIME_CHARACTERS) | set(extra_characters)
+    header, count, table_bytes, full_bytes = build_header(tft_dir, characters)
+    os.makedirs(output_dir, exist_ok=True)
+    write_if_changed(os.path.join(output_dir, "font_subset.h"), header)
+    used = ", ".join(str(f) for f in sorted(f for f in fonts if isinstance(f, int)))
+    report = ["Fonts im UI: %s; Subset Font 2/4: %d Zeichen, %s Tabellen (TFT_eSPI vollständig: %s)"
+              % (used or "-", count, format_size(table_bytes), format_size(full_bytes))]
+    return fonts, report, table_bytes
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+#                              SUBSET PRÜFEN
+# ═══════════════════════════════════════════════════════════════════════════════
+# Vergleicht den erzeugten Header Pixel für Pixel mit den Tabellen von
+# TFT_eSPI. Die Pixel kommen hier nicht aus TftFont.runs(), sondern aus einem
+# eigenen Durchlauf, der die Schleifen von TFT_eSPI::drawChar() nachbildet
+# (Font 2: Bitmap-Zeilen zu (Breite + 6) / 8 Byte, Font 4: RLE mit
+# Zeilenumbruch bei der Zeichenbreite).
+
+def library_pixels(tft, code):
+    """Pixel und Vorschub eines Zeichens wie TFT_eSPI::drawChar(code, 0, 0, font)."""
+    index = code - FIRST_CHARACTER
+    width, data = tft.widths[index], tft.glyphs[index]
+    pixels = set()
+
+    if tft.encoding == "bitmap":
+        w = (width + 6) // 8
+        for i in range(tft.height):
+            for k in range(w):
+                line = data[w * i + k] if w * i + k < len(data) else 0
+                for bit in range(8):
+                    if line & (0x80 >> bit):
+                        pixels.add((k * 8 + bit, i))
+    else:
+        px = py = pc = 0
+        total = width * tft.height
+        position = 0
+        while pc < total and position < len(data):
+            line = data[position]
+            position += 1
+            foreground = line & 0x80
+            line = (line & 0x7F) + 1
+            pc += line
+            while line:
+                if foreground:
+                    pixels.add((px, py))
+                px += 1
+                if px >= width:
+                    px = 0
+                    py += 1
+                line -= 1
+    return pixels, width
+
+
+def header_tables(path):
+    """FONTn_INDEX/GLYPHS/RUNS aus einem erzeugten font_subset.h."""
+    with open(path, encoding="utf-8") as f:
+        code = strip_comments(f.read())
+    arrays = {m.group(1): [int(v) for v in re.findall(r"\d+", m.group(2))]
+              for m in re.finditer(r"\b(FONT\d+_(?:INDEX|GLYPHS|RUNS))\s*\[\d*\]\s*=\s*\{(.*?)\};", code, re.S)}
+    tables = {}
+    for font in SUBSET_FONTS:
+        flat = arrays.get("FONT%d_GLYPHS" % font, [])
+        runs = arrays.get("FONT%d_RUNS" % font, [])
+        tables[font] = (arrays.get("FONT%d_INDEX" % font),
+                        [tuple(flat[i:i + 3]) for i in range(0, len(flat), 3)],
+                        [tuple(runs[i:i + 3]) for i in range(0, len(runs), 3)])
+    return tables
+
+
+def verify(tft_dir, header):
+    """Liefert die Abweichungen des Headers von TFT_eSPI (leer = identisch)."""
+    errors = []
+    for font, (index, glyphs, runs) in sorted(header_tables(header).items()):
+        if index is None or len(index) != CHARACTER_COUNT:
+            errors.append("Font %d: Index-Tabelle fehlt oder hat nicht %d Einträge" % (font, CHARACTER_COUNT))
+            continue
+        tft = TftFont(tft_dir, font)
+        for offset, entry in enumerate(index):
+            if entry == 0:
+                continue
+            code = FIRST_CHARACTER + offset
+            if entry > len(glyphs):
+                errors.append("Font %d %s: Glyph %d fehlt" % (font, describe(code), entry))
+                continue
+            first, count, advance = glyphs[entry - 1]
+            pixels = set()
+            for x, y, length in runs[first:first + count]:
+                pixels.update((x + i, y) for i in range(length))
+            expected, width = library_pixels(tft, code)
+            if count != len(runs[first:first + count]):
+                errors.append("Font %d %s: Läufe außerhalb der Tabelle" % (font, describe(code)))
+            elif advance != width:
+                errors.append("Font %d %s: Vorschub %d statt %d" % (font, describe(code), advance, width))
+            elif pixels != expected:
+                errors.append("Font %d %s: %d Pixel zu viel, %d fehlen"
+                              % (font, describe(code), len(pixels - expected), len(expected - pixels)))
+    return errors
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+#                              PLATFORMIO
+# ═══════════════════════════════════════════════════════════════════════════════
+
+FLAG = re.compile(r"-D\s*(%s)\b(=\S*)?" % "|".join(FONT_SWITCHES))
+
+
+def strip_unused_fonts(env, fonts):
+    """LOAD_FONTn etc. ungenutzter Fonts aus den build_flags; liefert die entfernten Schalter."""
+    flags = env.get("BUILD_FLAGS", [])
+    if not any("USER_SETUP_LOADED" in flag for flag in flags):
+        return None
+    removed = []
+
+    def drop(m):
+        if FONT_SWITCHES[m.group(1)] in fonts:
+            return m.group(0)
+        removed.append(m.group(1))
+        return ""
+
+    env.Replace(BUILD_FLAGS=[f for f in (FLAG.sub(drop, flag).strip() for flag in flags) if f])
+    return removed
+
+
+def run_platformio(env):
+    name = env["PIOENV"]
+    tft_dir = os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), name, "TFT_eSPI")
+    output_dir = os.path.join(env.subst("$BUILD_DIR"), "font_subset")
+    sources = source_files(env.subst("$PROJECT_SRC_DIR"),
+                           env.GetProjectOption("build_src_filter", DEFAULT_SRC_FILTER))
+    prefix = "Font-Subset [%s]:" % name
+
+    if not sources:
+        print("%s keine Quellen gefunden - Fonts unverändert" % prefix)
+        return
+    if not os.path.isfile(os.path.join(tft_dir, "Fonts", "Font16.c")):
+        print("%s TFT_eSPI nicht unter %s - Fonts unverändert" % (prefix, tft_dir))
+        return
+
+    fonts, report, table_bytes = generate(tft_dir, sources,
+                                          env.GetProjectOption("custom_font_subset_chars", ""), output_dir)
+    errors = verify(tft_dir, os.path.join(output_dir, "font_subset.h"))
+    if errors:
+        # Glyph-Cache zeichnet dann alles über TFT_eSPI
+        report.append("Subset weicht von TFT_eSPI ab, FONT_SUBSET aus: %s" % "; ".join(errors[:5]))
+        table_bytes = 0
+    else:
+        env.Append(CPPDEFINES=[("FONT_SUBSET", 1)], CPPPATH=[output_dir])
+
+    removed = strip_unused_fonts(env, fonts)
+    if removed is None:
+        report.append("Setup aus User_Setup.h: ungenutzte Fonts dort abschalten")
+    else:
+        sizes = font_sizes(tft_dir, [FONT_SWITCHES[s] for s in removed if isinstance(FONT_SWITCHES[s], int)])
+        saved = sum(s for s in sizes.values() if s)
+        parts = ["%s (%s)" % (s, format_size(sizes[FONT_SWITCHES[s]]) if FONT_SWITCHES[s] in sizes else "Code")
+                 for s in removed]
+        report.append("entfernt: %s" % (", ".join(parts) or "-"))
+        report.append("gespart: %s Font-Daten, netto %s nach den Subset-Tabellen"
+                      % (format_size(saved), format_size(saved - table_bytes)))
+
+    for line in report:
+        print("%s %s" % (prefix, line))
+    write_if_changed(os.path.join(output_dir, "report.txt"), "\n".join(report) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--tft-espi", required=True, help="Verzeichnis der TFT_eSPI-Bibliothek")
+    parser.add_argument("--src", default="src", help="Quellverzeichnis")
+    parser.add_argument("--filter", default=DEFAULT_SRC_FILTER, help="build_src_filter")
+    parser.add_argument("--chars", default="", help="zusätzliche Zeichen (custom_font_subset_chars)")
+    parser.add_argument("-o", "--output", required=True, help="Zielverzeichnis für font_subset.h")
+    parser.add_argument("--verify", action="store_true",
+                        help="vorhandenes font_subset.h nur gegen TFT_eSPI prüfen")
+    args = parser.parse_args()
+
+    if args.verify:
+        errors = verify(args.tft_espi, os.path.join(args.output, "font_subset.h"))
+        for error in errors:
+            print(error)
+        sys.exit(1 if errors else 0)
+
+    sources = source_files(args.src, args.filter)
+    if not sources:
+        sys.exit("keine Quellen unter %s" % args.src)
+    _, report, _ = generate(args.tft_espi, sources, args.chars, args.output)
+    for line in report:
+        print(line)
+
+
+try:
+    Import("env")   # noqa: F821 - von PlatformIO (SCons) bereitgestellt
+except NameError:
+    env = None
+
+if env is not None:
+    run_platformio(env)
+elif __name__ == "__main__":
+    main()